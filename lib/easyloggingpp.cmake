@@ -21,6 +21,7 @@ if(easyloggingpp_ADDED)
     PRIVATE cxx_std_11)
 
   target_compile_definitions(easyloggingpp
-    PUBLIC -DELPP_NO_DEFAULT_LOG_FILE)
+    PUBLIC -DELPP_NO_DEFAULT_LOG_FILE
+           -DELPP_THREAD_SAFE)
 
 endif()
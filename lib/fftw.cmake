@@ -0,0 +1,27 @@
+# https://www.fftw.org
+
+option(FFTW "Enable the optional FFTW backend if installed, which is GPL licensed" OFF)
+
+if(FFTW)
+
+  find_path(FFTW_INCLUDE_DIR fftw3.h)
+  find_library(FFTW_LIBRARY fftw3)
+  find_library(FFTWF_LIBRARY fftw3f)
+
+  if(FFTW_INCLUDE_DIR AND FFTW_LIBRARY AND FFTWF_LIBRARY)
+
+    add_library(fftw INTERFACE)
+
+    target_include_directories(fftw
+      INTERFACE "${FFTW_INCLUDE_DIR}")
+
+    target_link_libraries(fftw
+      INTERFACE "${FFTW_LIBRARY}"
+                "${FFTWF_LIBRARY}")
+
+    target_compile_definitions(fftw
+      INTERFACE -DVOYXFFTW)
+
+  endif()
+
+endif()
@@ -0,0 +1,1140 @@
+#include <voyx/Source.h>
+
+#include <voyx/alg/DecimatedPitchDetector.h>
+#include <voyx/alg/EnvelopeCache.h>
+#include <voyx/alg/FFT.h>
+#include <voyx/alg/HpsPitchDetector.h>
+#include <voyx/alg/LPC.h>
+#include <voyx/alg/Lifter.h>
+#include <voyx/alg/McLeodPitchDetector.h>
+#include <voyx/alg/PitchTracking.h>
+#include <voyx/alg/QDFT.h>
+#include <voyx/alg/SDFT.h>
+#include <voyx/alg/STFT.h>
+#include <voyx/alg/Vocoder.h>
+#include <voyx/dsp/ParallelRenderer.h>
+#include <voyx/dsp/PitchAnalyzer.h>
+#include <voyx/dsp/StftPipeline.h>
+#include <voyx/etc/SIMD.h>
+#include <voyx/etc/Windowing.h>
+
+INITIALIZE_EASYLOGGINGPP
+
+/**
+ * Repeats the specified kernel for at least the specified duration
+ * and prints the mean time per call as well as the real-time headroom,
+ * i.e. how many times faster the kernel is than the duration
+ * of the samples it consumes per call.
+ **/
+static void bench(const std::string& name, const size_t samples, const double samplerate, std::function<void()> kernel,
+                  const std::chrono::duration<double> duration = std::chrono::milliseconds(500))
+{
+  for (size_t i = 0; i < 10; ++i)
+  {
+    kernel();
+  }
+
+  size_t calls = 0;
+
+  const auto timestamp = std::chrono::steady_clock::now();
+
+  std::chrono::duration<double> elapsed;
+
+  do
+  {
+    for (size_t i = 0; i < 10; ++i)
+    {
+      kernel();
+    }
+
+    calls += 10;
+    elapsed = std::chrono::steady_clock::now() - timestamp;
+  }
+  while (elapsed < duration);
+
+  const double nanos = 1e9 * elapsed.count() / calls;
+  const double budget = 1e9 * samples / samplerate;
+
+  std::cout << std::left << std::setw(48) << name
+            << std::right << std::setw(14) << std::fixed << std::setprecision(0) << nanos << " ns/frame"
+            << std::setw(12) << std::setprecision(1) << budget / nanos << " x"
+            << std::endl;
+}
+
+template<typename T = sample_t>
+static std::vector<T> noise(const size_t size)
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<T> distribution(-1, 1);
+
+  std::vector<T> result(size);
+
+  for (auto& value : result)
+  {
+    value = distribution(generator);
+  }
+
+  return result;
+}
+
+/**
+ * Runs the specified samples through the STFT and vocoder round trip
+ * at the spectral precision F, as done by the pitch shifting pipelines.
+ **/
+template<typename F>
+static std::vector<sample_t> roundtrip(const std::vector<sample_t>& input, const double samplerate,
+                                       const size_t framesize, const size_t hopsize, const size_t dftsize)
+{
+  STFT<sample_t, F> stft(framesize, hopsize, dftsize);
+  Vocoder<F> vocoder(samplerate, framesize, hopsize, dftsize);
+
+  std::vector<std::complex<F>> dfts(stft.hops().size() * dftsize);
+  std::vector<sample_t> output(input.size());
+
+  for (size_t i = 0; i + framesize <= input.size(); i += framesize)
+  {
+    const voyx::matrix<std::complex<F>> frames(dfts, dftsize);
+
+    stft.stft(voyx::vector<sample_t>(input.data() + i, framesize), frames);
+    vocoder.encode(frames);
+    vocoder.decode(frames);
+    stft.istft(frames, voyx::vector<sample_t>(output.data() + i, framesize));
+  }
+
+  return output;
+}
+
+/**
+ * Prints the signal-to-noise ratio of the single precision
+ * spectral path with respect to the double precision one,
+ * returns false if it falls below the bound.
+ **/
+static bool snr(const std::string& name, const std::vector<sample_t>& reference, const std::vector<sample_t>& estimate)
+{
+  double signal = 0;
+  double noise = 0;
+
+  for (size_t i = 0; i < reference.size(); ++i)
+  {
+    signal += double(reference[i]) * reference[i];
+    noise += (double(reference[i]) - estimate[i]) * (double(reference[i]) - estimate[i]);
+  }
+
+  const double db = 10 * std::log10(signal / std::max(noise, std::numeric_limits<double>::min()));
+
+  const double bound = 50;
+
+  const bool ok = db > bound;
+
+  std::cout << std::left << std::setw(48) << name
+            << std::right << std::setw(14) << std::fixed << std::setprecision(1) << db << " dB"
+            << (ok ? " ok" : " exceeded")
+            << std::endl;
+
+  return ok;
+}
+
+/**
+ * Compares the dispatched vocoder kernels at precision F against the
+ * scalar Vocoder path at extended precision and prints the maximum
+ * encoder and decoder deviations, returns false if any exceeds the bound.
+ **/
+template<typename F>
+static bool vocoding(const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize)
+{
+  Vocoder<F> kernel(samplerate, framesize, hopsize, dftsize);
+  Vocoder<long double> reference(samplerate, framesize, hopsize, dftsize);
+
+  std::vector<std::complex<F>> x(dftsize);
+  std::vector<std::complex<long double>> y(dftsize);
+
+  const auto re = noise<F>(dftsize * 100);
+  const auto im = noise<F>(dftsize * 200);
+
+  // equivalent frequencies on both sides of the phase wrap
+  const double period = samplerate / hopsize;
+
+  double magnitude = 0;
+  double frequency = 0;
+  double polar = 0;
+
+  for (size_t frame = 0; frame < 100; ++frame)
+  {
+    for (size_t i = 0; i < dftsize; ++i)
+    {
+      x[i] = std::complex<F>(re[frame * dftsize + i], im[frame * dftsize + i + 1]);
+      y[i] = std::complex<long double>(x[i].real(), x[i].imag());
+    }
+
+    kernel.encode(voyx::vector<std::complex<F>>(x));
+    reference.encode(voyx::vector<std::complex<long double>>(y));
+
+    for (size_t i = 0; i < dftsize; ++i)
+    {
+      const double delta = std::abs(double(x[i].imag() - y[i].imag()));
+
+      magnitude = std::max(magnitude, std::abs(double(x[i].real() - y[i].real())));
+      frequency = std::max(frequency, std::min(delta, std::abs(delta - period)));
+
+      y[i] = std::complex<long double>(x[i].real(), x[i].imag());
+    }
+
+    kernel.decode(voyx::vector<std::complex<F>>(x));
+    reference.decode(voyx::vector<std::complex<long double>>(y));
+
+    for (size_t i = 0; i < dftsize; ++i)
+    {
+      polar = std::max(polar, double(std::abs(std::complex<long double>(x[i].real(), x[i].imag()) - y[i])));
+    }
+  }
+
+  // the single precision bound is dominated by the float arithmetic itself,
+  // since the scalar path deviates by the same order of magnitude
+  const double bound = std::is_same_v<F, float> ? 1e-2 : 1e-8;
+
+  const bool ok = (magnitude < bound) && (frequency < bound * samplerate) && (polar < bound);
+
+  std::cout << std::left << std::setw(48) << $("Vocoder {0} {1} error", voyx::simd::isa(), std::is_same_v<F, float> ? "float" : "double")
+            << std::right << std::scientific << std::setprecision(1)
+            << " abs " << magnitude << " freq " << frequency << " Hz polar " << polar
+            << (ok ? " ok" : " exceeded") << std::fixed
+            << std::endl;
+
+  return ok;
+}
+
+/**
+ * Compares the truncated cosine path of the Lifter at precision F
+ * against its FFT path on noisy magnitude spectra and prints the maximum
+ * relative envelope deviation, returns false if it exceeds the bound.
+ **/
+template<typename F>
+static bool lifting(const double samplerate, const size_t framesize)
+{
+  Lifter<F> lifter(1e-3, samplerate, framesize);
+
+  const size_t dftsize = framesize / 2 + 1;
+
+  std::vector<F> dft(dftsize);
+  std::vector<F> cosine(dftsize);
+  std::vector<F> reference(dftsize);
+  std::vector<F> logspectrum(dftsize);
+  std::vector<F> logcepstrum(framesize);
+
+  const auto values = noise<F>(dftsize * 10);
+
+  double error = 0;
+
+  for (size_t frame = 0; frame < 10; ++frame)
+  {
+    for (size_t i = 0; i < dftsize; ++i)
+    {
+      // a decaying spectral tilt with a random fine structure
+      dft[i] = std::abs(values[frame * dftsize + i]) / (1 + F(i) / 32) + F(1e-3);
+    }
+
+    // the FFT path is taken whenever the log cepstrum is requested
+    lifter.lowpass(voyx::vector<F>(dft), voyx::vector<F>(cosine));
+    lifter.template lowpass<$$::real>(voyx::vector<F>(dft), voyx::vector<F>(reference),
+                                      voyx::vector<F>(logspectrum), voyx::vector<F>(logcepstrum));
+
+    for (size_t i = 0; i < dftsize; ++i)
+    {
+      error = std::max(error, std::abs(double(cosine[i]) / double(reference[i]) - 1));
+    }
+  }
+
+  const double bound = std::is_same_v<F, float> ? 1e-4 : 1e-10;
+
+  const bool ok = error < bound;
+
+  std::cout << std::left << std::setw(48) << $("Lifter {0} cosine/fft error", std::is_same_v<F, float> ? "float" : "double")
+            << std::right << std::scientific << std::setprecision(1)
+            << " rel " << error
+            << (ok ? " ok" : " exceeded") << std::fixed
+            << std::endl;
+
+  return ok;
+}
+
+/**
+ * Estimates the envelope of a synthetic voiced spectrum with three
+ * formants and a harmonic plus noise fine structure at precision F
+ * and prints the mean absolute deviation in dB from the formant curve
+ * up to 5 kHz for LPC and the Lifter, returns false if the LPC
+ * deviation exceeds the bound.
+ **/
+template<typename F>
+static bool predicting(const double samplerate, const size_t framesize, const size_t order)
+{
+  LPC<F> lpc(order, framesize);
+  Lifter<F> lifter(1e-3, samplerate, framesize);
+
+  const size_t dftsize = framesize / 2 + 1;
+
+  std::vector<F> dft(dftsize);
+  std::vector<F> envelope(dftsize);
+  std::vector<double> formants(dftsize);
+
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> distribution(0.5, 1.5);
+
+  for (size_t i = 0; i < dftsize; ++i)
+  {
+    const double frequency = i * samplerate / framesize;
+
+    const auto formant = [&](const double center, const double bandwidth)
+    {
+      const double a = 1 - std::pow(frequency / center, 2);
+      const double b = frequency * bandwidth / (center * center);
+
+      return 1 / std::sqrt(a * a + b * b);
+    };
+
+    // harmonics of 150 Hz with a -60 dB noise floor in between
+    const double offset = std::fmod(frequency, 150.0);
+    const double harmonic = std::exp(-std::pow(std::min(offset, 150 - offset) / 15, 2)) + 1e-3;
+
+    formants[i] = formant(700, 100) * formant(1200, 120) * formant(2600, 200);
+    dft[i] = static_cast<F>(formants[i] * harmonic * distribution(generator));
+  }
+
+  // only the shape matters, so the deviation is
+  // relative to the mean dB offset of the estimate
+  const auto deviation = [&]()
+  {
+    const size_t size = static_cast<size_t>(5e3 * framesize / samplerate);
+
+    double mean = 0;
+
+    for (size_t i = 1; i < size; ++i)
+    {
+      mean += 20 * std::log10(envelope[i] / formants[i]);
+    }
+
+    mean /= size - 1;
+
+    double error = 0;
+
+    for (size_t i = 1; i < size; ++i)
+    {
+      error += std::abs(20 * std::log10(envelope[i] / formants[i]) - mean);
+    }
+
+    return error / (size - 1);
+  };
+
+  lpc.lowpass(voyx::vector<F>(dft), voyx::vector<F>(envelope));
+  const double predictive = deviation();
+
+  lifter.lowpass(voyx::vector<F>(dft), voyx::vector<F>(envelope));
+  const double cepstral = deviation();
+
+  const bool ok = predictive < 2;
+
+  std::cout << std::left << std::setw(48) << $("LPC order={0} {1} envelope error", order, std::is_same_v<F, float> ? "float" : "double")
+            << std::right << std::fixed << std::setprecision(2)
+            << " dB " << predictive << " lifter " << cepstral
+            << (ok ? " ok" : " exceeded")
+            << std::endl;
+
+  return ok;
+}
+
+/**
+ * Feeds the EnvelopeCache at precision F with a sequence of spectra
+ * and prints the number of decisions deviating from the expected ones,
+ * i.e. a stationary spectrum at a varying gain is reused until the
+ * staleness is reached, whereas a spectral change above the threshold
+ * and a reset enforce the estimation, returns false on any deviation.
+ **/
+template<typename F>
+static bool caching(const size_t dftsize)
+{
+  const size_t staleness = 4;
+
+  EnvelopeCache<F> cache(0.05, staleness);
+
+  std::vector<F> dft(dftsize);
+
+  const auto values = noise<F>(dftsize);
+
+  const auto spectrum = [&](const double tilt, const double gain)
+  {
+    for (size_t i = 0; i < dftsize; ++i)
+    {
+      // a fixed fine structure, which is to be preserved
+      const double decay = std::pow(1 + double(i) / 32, -tilt);
+
+      dft[i] = static_cast<F>(gain * decay * (1 + 0.1 * values[i]));
+    }
+
+    return cache.update(voyx::vector<F>(dft));
+  };
+
+  std::vector<bool> expected;
+  std::vector<bool> actual;
+
+  // the first frame is always estimated
+  expected.push_back(true);
+  actual.push_back(spectrum(1, 1));
+
+  // then reused until the staleness is reached
+  for (size_t i = 0; i < staleness; ++i)
+  {
+    expected.push_back(false);
+    actual.push_back(spectrum(1, 1 + 0.5 * i));
+  }
+
+  expected.push_back(true);
+  actual.push_back(spectrum(1, 1));
+
+  // a different tilt exceeds the threshold
+  expected.push_back(false);
+  actual.push_back(spectrum(1, 1));
+  expected.push_back(true);
+  actual.push_back(spectrum(2, 1));
+  expected.push_back(false);
+  actual.push_back(spectrum(2, 1));
+
+  // a reset enforces the estimation even if stationary
+  cache.reset();
+
+  expected.push_back(true);
+  actual.push_back(spectrum(2, 1));
+  expected.push_back(false);
+  actual.push_back(spectrum(2, 1));
+
+  size_t errors = 0;
+
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    errors += (expected[i] != actual[i]) ? 1 : 0;
+  }
+
+  const bool ok = errors == 0;
+
+  std::cout << std::left << std::setw(48) << $("EnvelopeCache {0} decision errors", std::is_same_v<F, float> ? "float" : "double")
+            << std::right
+            << " n " << errors << "/" << expected.size()
+            << (ok ? " ok" : " exceeded")
+            << std::endl;
+
+  return ok;
+}
+
+/**
+ * Detects the pitch of harmonic tones in light noise across the
+ * vocal range and prints the maximum deviation in cents and the
+ * minimum clarity, returns false if the deviation exceeds the bound.
+ *
+ * Each tone spans the specified number of consecutive frames,
+ * so that detectors with a history see a continuous signal,
+ * and only the estimate of the last frame is evaluated.
+ **/
+template<typename D>
+static bool pitching(const std::string& name, const double samplerate, const size_t framesize, D&& detector, const size_t blocks = 1)
+{
+  using F = phasor_t::value_type;
+
+  const auto jitter = noise<F>(framesize * blocks);
+
+  std::vector<F> samples(framesize);
+
+  const double pi = std::acos(-1.0);
+
+  double deviation = 0;
+  double clarity = 1;
+
+  for (double f0 = 80; f0 <= 800; f0 *= 1.05)
+  {
+    std::pair<double, double> estimate;
+
+    for (size_t j = 0; j < blocks; ++j)
+    {
+      for (size_t i = 0; i < framesize; ++i)
+      {
+        const double t = (j * framesize + i) / samplerate;
+
+        samples[i] = static_cast<F>(0.5 * std::sin(2 * pi * f0 * t) +
+                                    0.3 * std::sin(2 * pi * f0 * 2 * t + 1) +
+                                    0.2 * std::sin(2 * pi * f0 * 3 * t + 2) +
+                                    0.05 * jitter[j * framesize + i]);
+      }
+
+      estimate = detector.detect(samples);
+    }
+
+    const auto [f, c] = estimate;
+
+    deviation = std::max(deviation, (f > 0) ? std::abs(1200 * std::log2(f / f0)) : 1200);
+    clarity = std::min(clarity, c);
+  }
+
+  const double bound = 10;
+
+  const bool ok = deviation < bound;
+
+  std::cout << std::left << std::setw(48) << $("{0} fs={1} error", name, framesize)
+            << std::right << std::fixed << std::setprecision(2)
+            << " cents " << deviation << " clarity " << clarity
+            << (ok ? " ok" : " exceeded")
+            << std::endl;
+
+  return ok;
+}
+
+/**
+ * Adapts a spectral pitch detector to the time domain
+ * detect interface by the Hann windowed magnitude spectrum.
+ **/
+template<typename T, typename D>
+struct spectral
+{
+  D detector;
+  FFT<T> fft;
+
+  std::vector<T> buffer;
+  std::vector<std::complex<T>> dft;
+  std::vector<T> magnitudes;
+
+  spectral(const size_t framesize, D&& detector) :
+    detector(std::move(detector)),
+    fft(framesize),
+    buffer(framesize),
+    dft(framesize / 2 + 1),
+    magnitudes(framesize / 2 + 1)
+  {
+  }
+
+  std::pair<double, double> detect(const std::vector<T>& samples)
+  {
+    const double pi = std::acos(-1.0);
+
+    for (size_t i = 0; i < buffer.size(); ++i)
+    {
+      buffer[i] = static_cast<T>(samples[i] * (0.5 - 0.5 * std::cos(2 * pi * i / buffer.size())));
+    }
+
+    fft.fft(buffer, dft);
+
+    for (size_t i = 0; i < dft.size(); ++i)
+    {
+      magnitudes[i] = std::abs(dft[i]);
+    }
+
+    return { detector(magnitudes), 1 };
+  }
+};
+
+/**
+ * Shifts the pitch by the specified factor via the vocoder,
+ * so that the synthesis phases accumulate across frames.
+ **/
+class ShiftPipeline : public StftPipeline<>
+{
+
+public:
+
+  ShiftPipeline(const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize, const double factor,
+                std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink) :
+    StftPipeline(samplerate, framesize, hopsize, dftsize, source, sink),
+    vocoder(samplerate, framesize, hopsize, dftsize),
+    factor(factor),
+    spectra((framesize + hopsize - 1) / hopsize, dftsize),
+    magnitudes(dftsize),
+    frequencies(dftsize)
+  {
+  }
+
+  void operator()(const size_t index, const voyx::vector<sample_t> signal, voyx::matrix<phasor_t> dfts) override
+  {
+    vocoder.encode(dfts, spectra);
+
+    for (size_t k = 0; k < spectra.size(); ++k)
+    {
+      auto magnitude = spectra.magnitude(k);
+      auto frequency = spectra.frequency(k);
+
+      $$::interp(magnitude, voyx::vector(magnitudes), factor);
+      $$::interp(frequency, voyx::vector(frequencies), factor);
+
+      for (size_t i = 0; i < magnitude.size(); ++i)
+      {
+        magnitude[i] = magnitudes[i];
+        frequency[i] = frequencies[i] * static_cast<phasor_t::value_type>(factor);
+      }
+    }
+
+    vocoder.decode(spectra, dfts);
+  }
+
+private:
+
+  Vocoder<phasor_t::value_type> vocoder;
+  const double factor;
+
+  voyx::spectrum<phasor_t::value_type> spectra;
+  std::vector<phasor_t::value_type> magnitudes;
+  std::vector<phasor_t::value_type> frequencies;
+
+};
+
+/**
+ * Attenuates the upper bins by a fixed gain,
+ * so that each frame is processed independently.
+ **/
+class FilterPipeline : public StftPipeline<>
+{
+
+public:
+
+  FilterPipeline(const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize,
+                 std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink) :
+    StftPipeline(samplerate, framesize, hopsize, dftsize, source, sink),
+    gains(dftsize)
+  {
+    for (size_t i = 0; i < dftsize; ++i)
+    {
+      const double x = 8.0 * i / dftsize;
+
+      gains[i] = static_cast<phasor_t::value_type>(1 / (1 + x * x));
+    }
+  }
+
+  bool splittable() const override
+  {
+    return true;
+  }
+
+  void operator()(const size_t index, const voyx::vector<sample_t> signal, voyx::matrix<phasor_t> dfts) override
+  {
+    for (auto dft : dfts)
+    {
+      for (size_t i = 0; i < dft.size(); ++i)
+      {
+        dft[i] *= gains[i];
+      }
+    }
+  }
+
+private:
+
+  std::vector<phasor_t::value_type> gains;
+
+};
+
+/**
+ * Feeds the PitchTracking with an octave outlier, a pitch wobbling
+ * at a semitone boundary and clarities between both thresholds
+ * and prints the number of frames with an unexpected tracked key
+ * or voiced state, returns false on any deviation.
+ **/
+static bool tracking(const double concertpitch)
+{
+  PitchTracking tracking(concertpitch, 5, 0.25, { 0.6, 0.4 });
+
+  struct Frame
+  {
+    double key;
+    double clarity;
+    double expected;
+  };
+
+  const std::vector<Frame> frames =
+  {
+    // the lower threshold does not start a voiced section
+    { 57, 0.5, 0 },
+    { 57, 0.7, 57 },
+    // but sustains it
+    { 57, 0.5, 57 },
+    // the median rejects an octave outlier
+    { 69, 0.7, 57 },
+    { 57, 0.7, 57 },
+    // the hysteresis holds the key at the rounding boundary
+    { 57.6, 0.7, 57 },
+    { 57.4, 0.7, 57 },
+    { 57.6, 0.7, 57 },
+    { 57.4, 0.7, 57 },
+    { 57.6, 0.7, 57 },
+    { 57.6, 0.7, 57 },
+    // until the median moves beyond it
+    { 58, 0.7, 57 },
+    { 58, 0.7, 57 },
+    { 58, 0.7, 58 },
+    { 58, 0.7, 58 },
+    // the clarity falls below the lower threshold
+    { 58, 0.3, 0 },
+    { 58, 0.5, 0 },
+    { 58, 0.6, 58 },
+  };
+
+  size_t errors = 0;
+
+  for (const auto& frame : frames)
+  {
+    const double f0 = tracking($$::midi::freq(frame.key, concertpitch), frame.clarity);
+    const double key = (f0 > 0) ? std::round($$::midi::key(f0, concertpitch)) : 0;
+
+    const bool voiced = frame.expected > 0;
+
+    errors += (key != frame.expected || tracking.voiced() != voiced) ? 1 : 0;
+  }
+
+  const bool ok = errors == 0;
+
+  std::cout << std::left << std::setw(48) << "PitchTracking key errors"
+            << std::right
+            << " n " << errors << "/" << frames.size()
+            << (ok ? " ok" : " exceeded")
+            << std::endl;
+
+  return ok;
+}
+
+/**
+ * Renders a harmonic tone by the ParallelRenderer on one and on several
+ * workers and prints the maximum deviation in dB of the short-time level
+ * of the stitched output from the single-threaded one, returns false
+ * if it exceeds the specified bound, e.g. because the seams mix
+ * the unrelated synthesis phases of independent instances.
+ **/
+static bool stitching(const std::string& name, const double samplerate, const size_t framesize, const size_t dftsize, const size_t jobs,
+                      const double bound, ParallelRenderer::Factory factory)
+{
+  const size_t warmup = (dftsize * 2 - 2 + framesize) * 2;
+
+  std::vector<sample_t> input(static_cast<size_t>(8 * samplerate));
+
+  const auto values = noise(input.size() + 20);
+  const double pi = std::acos(-1.0);
+
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    double value = 0;
+
+    for (size_t harmonic = 1; harmonic <= 20; ++harmonic)
+    {
+      const double phase = pi * values[input.size() + harmonic - 1];
+
+      value += std::sin(2 * pi * 110 * harmonic * i / samplerate + phase) / harmonic;
+    }
+
+    input[i] = static_cast<sample_t>(0.2 * value + 1e-3 * values[i]);
+  }
+
+  std::vector<sample_t> reference;
+  std::vector<sample_t> estimate;
+
+  ParallelRenderer(samplerate, framesize, warmup, framesize, 1, factory)(input, reference);
+  ParallelRenderer(samplerate, framesize, warmup, framesize, jobs, factory)(input, estimate);
+
+  // the level of 20 ms blocks, which is sensitive
+  // to partial cancellation within a crossfade
+  const size_t block = static_cast<size_t>(20e-3 * samplerate);
+
+  double error = 0;
+
+  for (size_t i = 0; i + block <= input.size(); i += block)
+  {
+    double a = 0;
+    double b = 0;
+
+    for (size_t j = i; j < i + block; ++j)
+    {
+      a += double(reference[j]) * double(reference[j]);
+      b += double(estimate[j]) * double(estimate[j]);
+    }
+
+    if (a > 0 && b > 0)
+    {
+      error = std::max(error, std::abs(10 * std::log10(b / a)));
+    }
+  }
+
+  const bool ok = error < bound;
+
+  std::cout << std::left << std::setw(48) << $("ParallelRenderer {0} jobs={1} level error", name, jobs)
+            << std::right << std::fixed << std::setprecision(2)
+            << " dB " << error
+            << (ok ? " ok" : " exceeded")
+            << std::endl;
+
+  return ok;
+}
+
+int main(int argc, char** argv)
+{
+  const double samplerate = 44100;
+
+  std::cout << std::left << std::setw(48) << "kernel"
+            << std::right << std::setw(23) << "time"
+            << std::setw(14) << "headroom"
+            << std::endl;
+
+  for (const size_t framesize : { 256, 512, 1024, 2048, 4096 })
+  {
+    const size_t dftsize = framesize / 2 + 1;
+    const size_t hops = 4;
+
+    using F = phasor_t::value_type;
+
+    FFT<F> fft(framesize);
+
+    auto samples = noise<F>(framesize * hops);
+    std::vector<phasor_t> dfts(dftsize * hops);
+
+    const std::vector<std::pair<FFTBackend, std::string>> backends =
+    {
+      { FFTBackend::PocketFFT, "pocketfft" },
+      { FFTBackend::Radix2, "radix2" },
+      { FFTBackend::FFTW, "fftw" }
+    };
+
+    for (const auto& [backend, name] : backends)
+    {
+      if (!FFT<F>::available(backend, framesize))
+      {
+        continue;
+      }
+
+      FFT<F> candidate(framesize, backend);
+
+      bench($("FFT::fft+ifft {0} fs={1}{2}", name, framesize, candidate.backend() == fft.backend() ? " (auto)" : ""), framesize / hops, samplerate, [&]()
+      {
+        candidate.fft(voyx::vector<F>(samples.data(), framesize), voyx::vector<phasor_t>(dfts.data(), dftsize));
+        candidate.ifft(voyx::vector<phasor_t>(dfts.data(), dftsize), voyx::vector<F>(samples.data(), framesize));
+      });
+    }
+
+    bench($("FFT::fft vector fs={0}", framesize), framesize / hops, samplerate, [&]()
+    {
+      fft.fft(voyx::vector<F>(samples.data(), framesize), voyx::vector<phasor_t>(dfts.data(), dftsize));
+    });
+
+    bench($("FFT::ifft vector fs={0}", framesize), framesize / hops, samplerate, [&]()
+    {
+      fft.ifft(voyx::vector<phasor_t>(dfts.data(), dftsize), voyx::vector<F>(samples.data(), framesize));
+    });
+
+    bench($("FFT::fft matrix fs={0} hops={1}", framesize, hops), framesize, samplerate, [&]()
+    {
+      fft.fft(voyx::matrix<F>(samples, framesize), voyx::matrix<phasor_t>(dfts, dftsize));
+    });
+
+    bench($("FFT::ifft matrix fs={0} hops={1}", framesize, hops), framesize, samplerate, [&]()
+    {
+      fft.ifft(voyx::matrix<phasor_t>(dfts, dftsize), voyx::matrix<F>(samples, framesize));
+    });
+
+    McLeodPitchDetector<F> mpm({ 50, 1000 }, samplerate, framesize);
+
+    bench($("McLeodPitchDetector fs={0}", framesize), framesize / hops, samplerate, [&]()
+    {
+      mpm(voyx::vector<F>(samples.data(), framesize));
+    });
+
+    DecimatedPitchDetector<F> dpd({ 50, 1000 }, samplerate, framesize, 4);
+
+    bench($("DecimatedPitchDetector x4 fs={0}", framesize), framesize / hops, samplerate, [&]()
+    {
+      dpd(voyx::vector<F>(samples.data(), framesize));
+    });
+
+    std::vector<F> magnitudes(dftsize);
+
+    fft.fft(voyx::vector<F>(samples.data(), framesize), voyx::vector<phasor_t>(dfts.data(), dftsize));
+
+    for (size_t i = 0; i < dftsize; ++i)
+    {
+      magnitudes[i] = std::abs(dfts[i]);
+    }
+
+    HpsPitchDetector<F> hps({ 50, 1000 }, samplerate, framesize);
+
+    bench($("HpsPitchDetector fs={0}", framesize), framesize / hops, samplerate, [&]()
+    {
+      hps(magnitudes);
+    });
+  }
+
+  for (const size_t framesize : { 256, 512, 1024, 2048 })
+  {
+    for (const size_t overlap : { 2, 4, 8 })
+    {
+      for (const size_t dftsize : { framesize / 2 + 1, framesize + 1 })
+      {
+        const size_t hopsize = framesize / overlap;
+
+        STFT<sample_t, phasor_t::value_type> stft(framesize, hopsize, dftsize);
+
+        auto samples = noise(framesize);
+        std::vector<phasor_t> dfts(stft.hops().size() * dftsize);
+
+        bench($("STFT::stft fs={0} ov={1} dft={2}", framesize, overlap, dftsize), framesize, samplerate, [&]()
+        {
+          stft.stft(samples, voyx::matrix<phasor_t>(dfts, dftsize));
+        });
+
+        bench($("STFT::istft fs={0} ov={1} dft={2}", framesize, overlap, dftsize), framesize, samplerate, [&]()
+        {
+          stft.istft(voyx::matrix<phasor_t>(dfts, dftsize), samples);
+        });
+      }
+    }
+  }
+
+  for (const size_t framesize : { 1024, 2048, 4096, 8192 })
+  {
+    for (const size_t overlap : { 4, 8, 16 })
+    {
+      const size_t hopsize = framesize / overlap;
+
+      const auto window = $$::window<sample_t>(framesize);
+
+      auto input = noise(framesize * 2);
+      auto output = noise(framesize * 2);
+      auto frames = noise<phasor_t::value_type>(framesize * overlap);
+
+      const voyx::vector<sample_t> x(input);
+      voyx::vector<sample_t> y(output);
+      voyx::matrix<phasor_t::value_type> z(frames, framesize);
+
+      bench($("reject scalar fs={0} ov={1}", framesize, overlap), framesize, samplerate, [&]()
+      {
+        for (size_t i = 0; i < overlap; ++i)
+        {
+          auto frame = z[i];
+
+          for (size_t j = 0; j < framesize; ++j)
+          {
+            frame[j] = x[i * hopsize + j] * window[j];
+          }
+        }
+      });
+
+      bench($("reject {0} fs={1} ov={2}", voyx::simd::isa(), framesize, overlap), framesize, samplerate, [&]()
+      {
+        for (size_t i = 0; i < overlap; ++i)
+        {
+          voyx::windowing::multiply(x.data() + i * hopsize, window.data(), z[i].data(), framesize);
+        }
+      });
+
+      bench($("inject scalar fs={0} ov={1}", framesize, overlap), framesize, samplerate, [&]()
+      {
+        for (size_t i = 0; i < overlap; ++i)
+        {
+          const auto frame = z[i];
+
+          for (size_t j = 0; j < framesize; ++j)
+          {
+            y[i * hopsize + j] += frame[j] * window[j];
+          }
+        }
+      });
+
+      bench($("inject {0} fs={1} ov={2}", voyx::simd::isa(), framesize, overlap), framesize, samplerate, [&]()
+      {
+        for (size_t i = 0; i < overlap; ++i)
+        {
+          voyx::windowing::accumulate(z[i].data(), window.data(), y.data() + i * hopsize, framesize);
+        }
+      });
+    }
+  }
+
+  {
+    const size_t framesize = 1024;
+    const size_t hopsize = framesize / 4;
+    const size_t dftsize = framesize + 1;
+
+    STFT<sample_t, phasor_t::value_type> stft(framesize, hopsize, dftsize);
+    Vocoder<phasor_t::value_type> vocoder(samplerate, framesize, hopsize, dftsize);
+    Lifter<phasor_t::value_type> lifter(1e-3, samplerate, dftsize * 2 - 2);
+
+    auto samples = noise(framesize);
+    std::vector<phasor_t> dfts(stft.hops().size() * dftsize);
+    std::vector<phasor_t> buffer(4 * dftsize);
+    std::vector<phasor_t::value_type> envelope(dftsize);
+
+    stft.stft(samples, voyx::matrix<phasor_t>(dfts, dftsize));
+
+    const std::vector<phasor_t> original = dfts;
+
+    bench($("Vocoder::encode fs={0} dft={1}", framesize, dftsize), framesize, samplerate, [&]()
+    {
+      std::copy(original.begin(), original.end(), dfts.begin());
+      vocoder.encode(voyx::matrix<phasor_t>(dfts, dftsize));
+    });
+
+    bench($("Vocoder::decode fs={0} dft={1}", framesize, dftsize), framesize, samplerate, [&]()
+    {
+      vocoder.decode(voyx::matrix<phasor_t>(dfts, dftsize));
+    });
+
+    voyx::spectrum<phasor_t::value_type> spectrum(stft.hops().size(), dftsize);
+    voyx::spectrum<phasor_t::value_type> buffers(4, dftsize);
+
+    bench($("Vocoder::encode soa fs={0} dft={1}", framesize, dftsize), framesize, samplerate, [&]()
+    {
+      vocoder.encode(voyx::matrix<phasor_t>(original, dftsize), spectrum);
+    });
+
+    bench($("Vocoder::decode soa fs={0} dft={1}", framesize, dftsize), framesize, samplerate, [&]()
+    {
+      vocoder.decode(spectrum, voyx::matrix<phasor_t>(dfts, dftsize));
+    });
+
+    bench($("Lifter::divide dft={0}", dftsize), framesize, samplerate, [&]()
+    {
+      lifter.divide<$$::real>(voyx::vector<phasor_t>(dfts.data(), dftsize), envelope);
+    });
+
+    bench($("Lifter::divide soa dft={0}", dftsize), framesize, samplerate, [&]()
+    {
+      lifter.divide(spectrum.magnitude(0), envelope);
+    });
+
+    bench($("$$::interp soa dft={0}", dftsize), framesize, samplerate, [&]()
+    {
+      $$::interp(spectrum.magnitude(0), buffers.magnitude(0), 1.5);
+      $$::interp(spectrum.frequency(0), buffers.frequency(0), 1.5);
+    });
+
+    bench($("$$::argmax soa 4x{0}", dftsize), framesize, samplerate, [&]()
+    {
+      const auto mask = $$::argmax<$$::real>(buffers.magnitudes());
+    });
+
+    bench($("Lifter::lowpass dft={0}", dftsize), framesize, samplerate, [&]()
+    {
+      lifter.lowpass<$$::real>(voyx::vector<phasor_t>(original.data(), dftsize), envelope);
+    });
+
+    std::vector<phasor_t::value_type> logspectrum(dftsize);
+    std::vector<phasor_t::value_type> logcepstrum(dftsize * 2 - 2);
+
+    bench($("Lifter::lowpass fft dft={0}", dftsize), framesize, samplerate, [&]()
+    {
+      lifter.lowpass<$$::real>(voyx::vector<phasor_t>(original.data(), dftsize), envelope, logspectrum, logcepstrum);
+    });
+
+    LPC<phasor_t::value_type> lpc(32, dftsize * 2 - 2);
+
+    bench($("LPC::lowpass order=32 dft={0}", dftsize), framesize, samplerate, [&]()
+    {
+      lpc.lowpass<$$::real>(voyx::vector<phasor_t>(original.data(), dftsize), envelope);
+    });
+
+    EnvelopeCache<phasor_t::value_type> cache(0.05, 8);
+
+    bench($("EnvelopeCache::update soa dft={0}", dftsize), framesize, samplerate, [&]()
+    {
+      cache.update(spectrum.magnitude(0));
+    });
+
+    bench($("$$::interp dft={0}", dftsize), framesize, samplerate, [&]()
+    {
+      $$::interp(voyx::vector<phasor_t>(original.data(), dftsize), voyx::vector<phasor_t>(buffer.data(), dftsize), 1.5);
+    });
+
+    bench($("$$::argmax 4x{0}", dftsize), framesize, samplerate, [&]()
+    {
+      const auto mask = $$::argmax<$$::real>(voyx::matrix<phasor_t>(buffer, dftsize));
+    });
+  }
+
+  for (const size_t dftsize : { 256, 512, 1024 })
+  {
+    const size_t framesize = 256;
+
+    SDFT<sample_t, phasor_t::value_type> sdft(dftsize);
+
+    auto samples = noise(framesize);
+    std::vector<phasor_t> dfts(framesize * dftsize);
+
+    bench($("SDFT::sdft fs={0} dft={1}", framesize, dftsize), framesize, samplerate, [&]()
+    {
+      sdft.sdft(framesize, samples.data(), dfts.data());
+    });
+
+    bench($("SDFT::isdft fs={0} dft={1}", framesize, dftsize), framesize, samplerate, [&]()
+    {
+      sdft.isdft(framesize, dfts.data(), samples.data());
+    });
+  }
+
+  {
+    const size_t framesize = 256;
+
+    QDFT<sample_t, phasor_t::value_type> qdft(samplerate, { 50, 15000 }, 24, 0);
+
+    auto samples = noise(framesize);
+    std::vector<phasor_t> dfts(framesize * qdft.size());
+
+    bench($("QDFT::qdft fs={0} dft={1}", framesize, qdft.size()), framesize, samplerate, [&]()
+    {
+      qdft.qdft(framesize, samples.data(), dfts.data());
+    });
+
+    bench($("QDFT::iqdft fs={0} dft={1}", framesize, qdft.size()), framesize, samplerate, [&]()
+    {
+      qdft.iqdft(framesize, dfts.data(), samples.data());
+    });
+  }
+
+  // run every check, even if a previous one already failed
+  bool ok = true;
+
+  for (const size_t framesize : { 512, 1024, 2048 })
+  {
+    const size_t hopsize = framesize / 4;
+    const size_t dftsize = framesize + 1;
+
+    const auto input = noise(size_t(samplerate) / framesize * framesize);
+
+    ok &= snr($("SNR float/double fs={0} dft={1}", framesize, dftsize),
+        roundtrip<double>(input, samplerate, framesize, hopsize, dftsize),
+        roundtrip<float>(input, samplerate, framesize, hopsize, dftsize));
+  }
+
+  ok &= vocoding<float>(samplerate, 1024, 256, 1025);
+  ok &= vocoding<double>(samplerate, 1024, 256, 1025);
+  ok &= lifting<float>(samplerate, 2048);
+  ok &= lifting<double>(samplerate, 2048);
+  ok &= predicting<float>(samplerate, 2048, 24);
+  ok &= predicting<double>(samplerate, 2048, 24);
+  ok &= predicting<float>(samplerate, 2048, 40);
+  ok &= predicting<double>(samplerate, 2048, 40);
+  ok &= caching<float>(1025);
+  ok &= caching<double>(1025);
+  ok &= pitching("McLeodPitchDetector", samplerate, 2048, McLeodPitchDetector<phasor_t::value_type>({ 50, 1000 }, samplerate, 2048));
+  ok &= pitching("DecimatedPitchDetector", samplerate, 2048, DecimatedPitchDetector<phasor_t::value_type>({ 50, 1000 }, samplerate, 2048));
+
+  for (const size_t framesize : { 256, 512, 1024 })
+  {
+    PitchAnalyzer<phasor_t::value_type> analyzer({ 50, 1000 }, samplerate, framesize, 440);
+
+    // the block sizes of the sliding pipeline, which need the history
+    const size_t blocks = (analyzer.window() + framesize - 1) / framesize;
+
+    ok &= pitching("PitchAnalyzer", samplerate, framesize, analyzer, blocks);
+  }
+
+  ok &= pitching("HpsPitchDetector", samplerate, 4096, spectral<phasor_t::value_type, HpsPitchDetector<phasor_t::value_type>>(4096, HpsPitchDetector<phasor_t::value_type>({ 50, 1000 }, samplerate, 4096, 2)));
+  ok &= tracking(440);
+
+  ok &= stitching("FilterPipeline", samplerate, 1024, 513, 4, 0.1, [&](auto source, auto sink) -> std::shared_ptr<Pipeline<sample_t>>
+  {
+    return std::make_shared<FilterPipeline>(samplerate, 1024, 256, 513, source, sink);
+  });
+
+  // not splittable, thus expected to match the single-threaded render
+  ok &= stitching("ShiftPipeline", samplerate, 1024, 513, 4, 0.1, [&](auto source, auto sink) -> std::shared_ptr<Pipeline<sample_t>>
+  {
+    return std::make_shared<ShiftPipeline>(samplerate, 1024, 256, 513, 1.5, source, sink);
+  });
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
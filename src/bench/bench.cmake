@@ -0,0 +1,64 @@
+option(BENCH "Build voyx_bench microbenchmarks" OFF)
+
+if (BENCH)
+
+  add_executable(voyx_bench)
+
+  target_sources(voyx_bench
+    PRIVATE "${CMAKE_CURRENT_LIST_DIR}/Bench.cpp"
+            "${CMAKE_CURRENT_LIST_DIR}/../voyx/dsp/ParallelRenderer.cpp"
+            "${CMAKE_CURRENT_LIST_DIR}/../voyx/etc/Allocation.cpp"
+            "${CMAKE_CURRENT_LIST_DIR}/../voyx/etc/Harmonics.cpp"
+            "${CMAKE_CURRENT_LIST_DIR}/../voyx/etc/Lifting.cpp"
+            "${CMAKE_CURRENT_LIST_DIR}/../voyx/etc/Vocoding.cpp"
+            "${CMAKE_CURRENT_LIST_DIR}/../voyx/etc/Windowing.cpp"
+            "${CMAKE_CURRENT_LIST_DIR}/../voyx/io/MemorySink.cpp"
+            "${CMAKE_CURRENT_LIST_DIR}/../voyx/io/MemorySource.cpp")
+
+  target_include_directories(voyx_bench
+    PRIVATE "${CMAKE_CURRENT_LIST_DIR}/..")
+
+  target_link_libraries(voyx_bench
+    PRIVATE easyloggingpp
+            fmt
+            mlinterp
+            pocketfft
+            qdft
+            readerwriterqueue
+            sdft
+            xtensor
+            xtl)
+
+  target_compile_features(voyx_bench
+    PRIVATE cxx_std_20)
+
+  if (MSVC)
+
+    target_compile_options(voyx_bench
+      PRIVATE /fp:fast)
+
+    target_compile_definitions(voyx_bench
+      PRIVATE _USE_MATH_DEFINES NOMINMAX)
+
+  else()
+
+    target_compile_options(voyx_bench
+      PRIVATE -ffast-math)
+
+  endif()
+
+  if (UNIX)
+
+    target_link_libraries(voyx_bench
+      PRIVATE pthread)
+
+  endif()
+
+  if (TARGET fftw)
+
+    target_link_libraries(voyx_bench
+      PRIVATE fftw)
+
+  endif()
+
+endif()
@@ -6,6 +6,7 @@
 #include <voyx/ui/Plot.h>
 #include <voyx/ui/QPlot.h>
 
+#include <voyx/io/AudioDuplex.h>
 #include <voyx/io/AudioSink.h>
 #include <voyx/io/AudioSource.h>
 #include <voyx/io/FileSink.h>
@@ -26,6 +27,14 @@
 #include <voyx/dsp/StftTestPipeline.h>
 #include <voyx/dsp/VoiceSynthPipeline.h>
 
+#include <voyx/dsp/BatchProcessor.h>
+#include <voyx/dsp/ParallelRenderer.h>
+#include <voyx/dsp/PipelineBenchmark.h>
+#include <voyx/dsp/PipelineFactory.h>
+#include <voyx/etc/Allocation.h>
+#include <voyx/etc/Tracer.h>
+#include <voyx/etc/WAV.h>
+
 #include <cxxopts.hpp>
 
 INITIALIZE_EASYLOGGINGPP
@@ -36,12 +45,14 @@ const int NOK = EXIT_FAILURE;
 std::condition_variable condition;
 std::mutex mutex;
 
+std::string trace;
+
 void onsignal(int value)
 {
   condition.notify_one();
 }
 
-int main(int argc, char** argv)
+int run(int argc, char** argv)
 {
   std::signal(SIGINT, onsignal);
 
@@ -50,19 +61,27 @@ int main(int argc, char** argv)
   options.set_width(80);
 
   options.add_options()
-    ("h,help",    "Print this help")
-    ("l,list",    "List available devices for -m, -i and -o")
-    ("m,midi",    "Input MIDI device name", cxxopts::value<std::string>()->default_value(""))
-    ("i,input",   "Input audio device or .wav file name", cxxopts::value<std::string>()->default_value(""))
-    ("o,output",  "Output audio device or .wav file name", cxxopts::value<std::string>()->default_value(""))
-    ("s,seconds", "Abort after specified number of seconds", cxxopts::value<int>()->default_value("0"))
-    ("t,timeout", "Timeout in milliseconds", cxxopts::value<int>()->default_value("0"))
-    ("a,a4",      "Concert pitch in hertz", cxxopts::value<double>()->default_value("440"))
-    ("r,sr",      "Sample rate in hertz", cxxopts::value<double>()->default_value("44100"))
-    ("w,window",  "STFT window size", cxxopts::value<int>()->default_value("1024"))
-    ("v,overlap", "STFT window overlap", cxxopts::value<int>()->default_value("4"))
-    ("b,buffer",  "Audio fifo size", cxxopts::value<int>()->default_value("100"))
-    ("d,debug",   "Enable debug mode");
+    ("h,help",      "Print this help")
+    ("l,list",      "List available devices for -m, -i and -o")
+    ("m,midi",      "Input MIDI device name", cxxopts::value<std::string>()->default_value(""))
+    ("i,input",     "Input audio device or .wav file name", cxxopts::value<std::string>()->default_value(""))
+    ("o,output",    "Output audio device or .wav file name", cxxopts::value<std::string>()->default_value(""))
+    ("s,seconds",   "Abort after specified number of seconds", cxxopts::value<int>()->default_value("0"))
+    ("t,timeout",   "Timeout in milliseconds", cxxopts::value<int>()->default_value("0"))
+    ("a,a4",        "Concert pitch in hertz", cxxopts::value<double>()->default_value("440"))
+    ("r,sr",        "Sample rate in hertz", cxxopts::value<double>()->default_value("44100"))
+    ("w,window",    "STFT window size", cxxopts::value<int>()->default_value("1024"))
+    ("v,overlap",   "STFT window overlap", cxxopts::value<int>()->default_value("4"))
+    ("b,buffer",    "Audio fifo size", cxxopts::value<int>()->default_value("100"))
+    ("x,duplex",    "Process the input and output audio device in a single full-duplex stream")
+    ("p,parallel",  "Run STFT analysis, processing and synthesis, or the SDFT pitch analysis, on separate threads")
+    ("f,offline",   "Render the input .wav file into the output .wav file as fast as possible")
+    ("j,jobs",      "Number of offline render threads or 0 for all cores", cxxopts::value<int>()->default_value("1"))
+    ("c,batch",     "Process a job manifest file or a directory of .wav files", cxxopts::value<std::string>()->default_value(""))
+    ("benchmark",   "Run each pipeline unthrottled for the specified number of frames and write .csv or .json results", cxxopts::value<int>()->default_value("0"))
+    ("allocabort",  "Abort on any heap allocation in the realtime path, requires the ALLOCGUARD build option")
+    ("trace",       "Write a Chrome trace of the frame processing into the specified .json file", cxxopts::value<std::string>()->default_value(""))
+    ("d,debug",     "Enable debug mode");
 
   const auto args = options.parse(argc, argv);
 
@@ -107,6 +126,9 @@ int main(int argc, char** argv)
   const std::string midi = args["midi"].as<std::string>();
   const std::string input = args["input"].as<std::string>();
   const std::string output = args["output"].as<std::string>();
+  const std::string batch = args["batch"].as<std::string>();
+  trace = args["trace"].as<std::string>();
+  const size_t benchmark = std::abs(args["benchmark"].as<int>());
 
   const int seconds = std::abs(args["seconds"].as<int>());
   const int timeout = std::abs(args["timeout"].as<int>());
@@ -117,13 +139,138 @@ int main(int argc, char** argv)
   const size_t framesize = std::abs(args["window"].as<int>());
   const size_t hopsize = framesize / std::abs(args["overlap"].as<int>());
   const size_t buffersize = std::abs(args["buffer"].as<int>());
+  const size_t dftsize = 1*1024 + /* nyquist */ 1;
 
+  const bool duplex = args.count("duplex");
+  const bool parallel = args.count("parallel");
+  const bool offline = args.count("offline");
+  const size_t jobs = std::abs(args["jobs"].as<int>())
+    ? std::abs(args["jobs"].as<int>())
+    : std::max<size_t>(std::thread::hardware_concurrency(), 1);
   const bool debug = args.count("debug");
 
+  if (!trace.empty())
+  {
+    voyx::tracer::start();
+  }
+
+  if (args.count("allocabort"))
+  {
+    if (!voyx::allocation::enabled())
+    {
+      LOG(WARNING) << "Allocation guard is not available in this build!";
+    }
+
+    voyx::allocation::mode(voyx::allocation::Mode::Abort);
+
+    if (!FFT<sample_t>::available(FFTBackend::Radix2, framesize) &&
+        !FFT<sample_t>::available(FFTBackend::FFTW, framesize))
+    {
+      LOG(WARNING) << "The PocketFFT backend of a non power of two window size allocates in each frame!";
+    }
+  }
+
+  if (!batch.empty())
+  {
+    const BatchProcessor::Job defaults =
+    {
+      "", "", "stftpitchshift",
+      samplerate, framesize, hopsize, dftsize
+    };
+
+    BatchProcessor process(defaults, jobs);
+
+    const size_t failures = process(process.load(batch, output));
+
+    if (!trace.empty())
+    {
+      voyx::tracer::dump(trace);
+    }
+
+    return failures ? NOK : OK;
+  }
+
+  if (benchmark > 0)
+  {
+    auto factory = [&]() -> std::shared_ptr<Source<>>
+    {
+      if ($$::imatch(input, "null"))
+      {
+        return std::make_shared<NullSource>(samplerate, framesize, buffersize);
+      }
+      else if ($$::imatch(input, "sine"))
+      {
+        return std::make_shared<SineSource>(0.5, concertpitch, samplerate, framesize, buffersize);
+      }
+      else if ($$::imatch(input, "sweep"))
+      {
+        return std::make_shared<SweepSource>(0.5, std::make_pair(concertpitch / 2, concertpitch * 2), 10, samplerate, framesize, buffersize);
+      }
+      else
+      {
+        return std::make_shared<NoiseSource>(0.5, samplerate, framesize, buffersize);
+      }
+    };
+
+    PipelineBenchmark bench(samplerate, framesize, hopsize, dftsize, benchmark, parallel, factory);
+
+    std::vector<PipelineBenchmark::Result> results;
+
+    for (const auto& name : PipelineFactory::names())
+    {
+      results.push_back(bench(name));
+
+      LOG(INFO) << $("Benchmarked {0}: {1:.1f} frames/s, real-time factor {2:.4f}, p99 {3:.1f} us.",
+                     name, results.back().fps, results.back().rtf, results.back().p99);
+    }
+
+    const std::string report = $$::imatch(output, ".*.json")
+      ? PipelineBenchmark::json(results)
+      : PipelineBenchmark::csv(results);
+
+    if ($$::imatch(output, ".*.(csv|json)"))
+    {
+      std::ofstream(output) << report;
+    }
+    else
+    {
+      std::cout << report;
+    }
+
+    return OK;
+  }
+
   std::shared_ptr<Source<>> source;
   std::shared_ptr<Sink<>> sink;
 
-  if (input.empty())
+  if (offline && !($$::imatch(input, ".*.wav") && $$::imatch(output, ".*.wav")))
+  {
+    throw std::runtime_error(
+      "Offline mode requires .wav input and output files!");
+  }
+
+  if (duplex && (offline || $$::imatch(input, "noise|null|sine|sweep|.*.wav") || $$::imatch(output, "null|.*.wav")))
+  {
+    throw std::runtime_error(
+      "Duplex mode requires audio input and output devices!");
+  }
+
+  if (duplex && parallel)
+  {
+    throw std::runtime_error(
+      "Parallel mode must not block the audio callback of the duplex mode!");
+  }
+
+  if (args.count("jobs") && !offline)
+  {
+    LOG(WARNING) << "The number of jobs only applies to the offline and batch modes, so -j is ignored!";
+  }
+
+  if (duplex)
+  {
+    source = std::make_shared<AudioDuplex>(input, output, samplerate, framesize);
+  }
+  else if (input.empty())
   {
     source = std::make_shared<NullSource>(samplerate, framesize, buffersize);
   }
@@ -145,14 +292,14 @@ int main(int argc, char** argv)
   }
   else if ($$::imatch(input, ".*.wav"))
   {
-    source = std::make_shared<FileSource>(input, samplerate, framesize, buffersize);
+    source = std::make_shared<FileSource>(input, samplerate, framesize, buffersize, !offline);
   }
   else
   {
     source = std::make_shared<AudioSource>(input, samplerate, framesize, buffersize);
   }
 
-  if (output.empty())
+  if (duplex || output.empty())
   {
     sink = std::make_shared<NullSink>(samplerate, framesize, buffersize);
   }
@@ -172,27 +319,80 @@ int main(int argc, char** argv)
   std::shared_ptr<MidiObserver> observer = midi.empty() ? nullptr : std::make_shared<MidiObserver>(midi, concertpitch);
 
   #ifdef VOYXUI
-  std::shared_ptr<Plot> plot = !debug ? nullptr : std::make_shared<QPlot>(source->timeout());
+  std::shared_ptr<Plot> plot = (!debug || offline) ? nullptr : std::make_shared<QPlot>(source->timeout());
   #else
   std::shared_ptr<Plot> plot = nullptr;
   #endif
 
-  const size_t dftsize = 1*1024 + /* nyquist */ 1;
+  auto pipeline = [&](std::shared_ptr<Source<>> source, std::shared_ptr<Sink<>> sink) -> std::shared_ptr<Pipeline<>>
+  {
+    // return std::make_shared<BypassPipeline>(source, sink);
+    // return std::make_shared<InverseSynthPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, observer, plot, parallel);
+    // return std::make_shared<QdftTestPipeline>(samplerate, framesize, source, sink, observer, plot);
+    // return std::make_shared<RobotPipeline>(samplerate, framesize, dftsize, source, sink, observer, plot);
+    // return std::make_shared<SdftTestPipeline>(samplerate, framesize, dftsize, source, sink, observer, plot);
+    // return std::make_shared<SlidingVoiceSynthPipeline>(samplerate, framesize, dftsize, source, sink, observer, plot, parallel);
+    return std::make_shared<StftPitchShiftPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, observer, plot);
+    // return std::make_shared<StftTestPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, observer, plot, parallel);
+    // return std::make_shared<VoiceSynthPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, observer, plot, parallel);
+    // return std::make_shared<VoiceSynthPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, observer, plot, parallel, EnvelopeEstimator::LPC);
+  };
+
+  if (offline && jobs > 1)
+  {
+    // all workers share the same MIDI observer, which is thread-safe
+    // since its accessors lock, but each segment sees the live key state
+    // at the time it is rendered instead of its position in the file
 
-  // auto pipe = std::make_shared<BypassPipeline>(source, sink);
-  // auto pipe = std::make_shared<InverseSynthPipeline>(samplerate, framesize, hopsize, source, sink, observer, plot);
-  // auto pipe = std::make_shared<QdftTestPipeline>(samplerate, framesize, source, sink, observer, plot);
-  // auto pipe = std::make_shared<RobotPipeline>(samplerate, framesize, dftsize, source, sink, observer, plot);
-  // auto pipe = std::make_shared<SdftTestPipeline>(samplerate, framesize, dftsize, source, sink, observer, plot);
-  // auto pipe = std::make_shared<SlidingVoiceSynthPipeline>(samplerate, framesize, dftsize, source, sink, observer, plot);
-  auto pipe = std::make_shared<StftPitchShiftPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, observer, plot);
-  // auto pipe = std::make_shared<StftTestPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, observer, plot);
-  // auto pipe = std::make_shared<VoiceSynthPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, observer, plot);
+    // twice the STFT history including the analysis window
+    const size_t warmup = (dftsize * 2 - 2 + framesize) * 2;
+
+    ParallelRenderer render(samplerate, framesize, warmup, framesize, jobs, pipeline);
+
+    std::vector<sample_t> data;
+    std::vector<sample_t> result;
+
+    WAV::read(input, data, samplerate);
+
+    const double duration = data.size() / samplerate;
+    const double elapsed = render(data, result).count();
+
+    WAV::write(output, result, samplerate);
+
+    LOG(INFO) << $("Rendered {0:.3f} s in {1:.3f} s using {2} threads, real-time factor {3:.3f}.",
+                   duration, elapsed, jobs, elapsed / duration);
+
+    if (!trace.empty())
+    {
+      voyx::tracer::dump(trace);
+    }
+
+    return OK;
+  }
+
+  auto pipe = pipeline(source, sink);
+
+  if (parallel && !pipe->concurrent())
+  {
+    LOG(WARNING) << "The selected pipeline does not support the parallel mode!";
+  }
 
   pipe->open();
 
-  if (seconds > 0)
+  if (offline)
+  {
+    const double duration = pipe->source->length() / samplerate;
+    const double elapsed = pipe->render().count();
+
+    LOG(INFO) << $("Rendered {0:.3f} s in {1:.3f} s, real-time factor {2:.3f}.",
+                   duration, elapsed, elapsed / duration);
+  }
+  else if (seconds > 0)
   {
+    // start blocks until the duration has elapsed,
+    // so let SIGINT terminate the process as usual
+    std::signal(SIGINT, SIG_DFL);
+
     pipe->start(
       std::chrono::seconds(seconds),
       std::chrono::milliseconds(timeout));
@@ -216,5 +416,30 @@ int main(int argc, char** argv)
 
   pipe->close();
 
+  if (!trace.empty())
+  {
+    voyx::tracer::dump(trace);
+  }
+
   return OK;
 }
+
+int main(int argc, char** argv)
+{
+  try
+  {
+    return run(argc, argv);
+  }
+  catch (const std::exception& exception)
+  {
+    LOG(ERROR) << exception.what();
+
+    // keep the trace of the frames preceding the failure
+    if (!trace.empty() && voyx::tracer::enabled())
+    {
+      voyx::tracer::dump(trace);
+    }
+
+    return NOK;
+  }
+}
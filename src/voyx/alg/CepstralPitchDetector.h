@@ -1,6 +1,7 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Profiler.h>
 
 template<typename T>
 class CepstralPitchDetector
@@ -16,6 +17,8 @@ public:
 
   double operator()(const voyx::vector<T> cepstrum) const
   {
+    voyxprofile("CepstralPitchDetector::detect");
+
     const size_t nmin = size_t(0);
     const size_t nmax = cepstrum.size() / 2;
 
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/alg/FIR.h>
+#include <voyx/alg/McLeodPitchDetector.h>
+#include <voyx/etc/Profiler.h>
+
+/**
+ * Pitch detection at a fraction of the sample rate,
+ * since the voice fundamental is far below the Nyquist frequency.
+ *
+ * The frame is lowpass filtered and decimated by the specified factor,
+ * then the McLeod pitch detector estimates the lag at the reduced rate.
+ * Finally the normalized square difference function is evaluated
+ * directly on the full rate frame, but only within one decimated lag
+ * around the coarse estimate, and refined by parabolic interpolation.
+ **/
+template<typename T>
+class DecimatedPitchDetector
+{
+
+public:
+
+  DecimatedPitchDetector(const std::pair<double, double> roi, const double samplerate, const size_t framesize, const size_t factor = 4, const double threshold = 0.9) :
+    samplerate(samplerate),
+    framesize(framesize),
+    factor(factor),
+    filter(FIR<T>::lowpass(0.4 / factor, 16 * factor + 1)),
+    decimated((framesize - (16 * factor + 1)) / factor + 1),
+    detector(roi, samplerate / factor, decimated.size(), threshold),
+    energies(framesize + 1),
+    nsdf(2 * factor + 3)
+  {
+    voyxassert(factor > 0);
+    voyxassert(framesize > (16 * factor + 1) + 3 * factor);
+  }
+
+  /**
+   * Returns the minimum frame size, which still covers two periods
+   * of the lowest frequency after the decimation and the filter delay.
+   **/
+  static size_t minimum(const std::pair<double, double> roi, const double samplerate, const size_t factor = 4)
+  {
+    const size_t taps = 16 * factor + 1;
+    const size_t period = static_cast<size_t>(std::ceil(samplerate / factor / std::min(roi.first, roi.second)));
+
+    return taps + factor * (2 * period + 2);
+  }
+
+  double operator()(const voyx::vector<T> samples)
+  {
+    return detect(samples).first;
+  }
+
+  /**
+   * Returns the estimated frequency in hertz and its clarity,
+   * or both zero if there is no periodicity in the lag range.
+   **/
+  std::pair<double, double> detect(const voyx::vector<T> samples)
+  {
+    voyxprofile("DecimatedPitchDetector::detect");
+
+    voyxassert(samples.size() == framesize);
+
+    filter.decimate(samples, decimated, factor);
+
+    const auto [frequency, clarity] = detector.detect(decimated);
+
+    if (frequency <= 0)
+    {
+      return { 0, 0 };
+    }
+
+    // cumulative energies for the normalization of arbitrary lags
+    energies[0] = 0;
+
+    for (size_t i = 0; i < framesize; ++i)
+    {
+      energies[i + 1] = energies[i] + samples[i] * samples[i];
+    }
+
+    const ptrdiff_t lag = static_cast<ptrdiff_t>(std::round(samplerate / frequency));
+    const ptrdiff_t radius = static_cast<ptrdiff_t>(factor);
+
+    const ptrdiff_t lmin = std::max<ptrdiff_t>(lag - radius, 2);
+    const ptrdiff_t lmax = std::min<ptrdiff_t>(lag + radius, framesize - 3);
+
+    if (lmin > lmax)
+    {
+      return { frequency, clarity };
+    }
+
+    for (ptrdiff_t l = lmin - 1; l <= lmax + 1; ++l)
+    {
+      const size_t overlap = framesize - l;
+
+      T correlation = 0;
+
+      for (size_t i = 0; i < overlap; ++i)
+      {
+        correlation += samples[i] * samples[i + l];
+      }
+
+      const T energy = energies[overlap] + (energies[framesize] - energies[l]);
+
+      nsdf[l - (lmin - 1)] = (energy > 0) ? 2 * correlation / energy : 0;
+    }
+
+    ptrdiff_t best = lmin;
+
+    for (ptrdiff_t l = lmin; l <= lmax; ++l)
+    {
+      if (nsdf[l - (lmin - 1)] > nsdf[best - (lmin - 1)])
+      {
+        best = l;
+      }
+    }
+
+    const T a = nsdf[best - lmin];
+    const T b = nsdf[best - lmin + 1];
+    const T c = nsdf[best - lmin + 2];
+
+    const T curvature = a - 2 * b + c;
+    const T shift = (curvature < 0) ? std::clamp<T>((a - c) / (2 * curvature), -1, +1) : 0;
+    const T peak = b - (a - c) * shift / 4;
+
+    return { samplerate / (best + shift), std::clamp<T>(peak, 0, 1) };
+  }
+
+private:
+
+  const double samplerate;
+  const size_t framesize;
+  const size_t factor;
+
+  const FIR<T> filter;
+
+  std::vector<T> decimated;
+
+  McLeodPitchDetector<T> detector;
+
+  std::vector<T> energies;
+  std::vector<T> nsdf;
+
+};
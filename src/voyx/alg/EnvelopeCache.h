@@ -0,0 +1,118 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/etc/Profiler.h>
+
+/**
+ * Decides whether a spectral envelope estimated from a previous frame
+ * can be reused for the current frame, e.g. while sustaining a vowel.
+ *
+ * The magnitude spectrum is decimated into bands of adjacent bins,
+ * and the spectral flux is the total variation distance between the
+ * normalized bands of the current frame and the frame of the last
+ * envelope estimation. So the flux is between 0 and 1 and insensitive
+ * to the overall gain, which cancels out anyway as long as the same
+ * envelope is used to flatten and to restore the spectrum.
+ *
+ * Comparing against the last estimation instead of the previous frame
+ * lets slow drifts accumulate until they exceed the threshold.
+ * Regardless of the flux, a reused envelope is never older than
+ * the specified staleness in frames.
+ **/
+template<typename T>
+class EnvelopeCache
+{
+
+public:
+
+  EnvelopeCache(const double threshold, const size_t staleness, const size_t decimation = 8) :
+    threshold(threshold),
+    staleness(staleness),
+    decimation(std::max<size_t>(decimation, 1))
+  {
+  }
+
+  /**
+   * Returns true if the envelope needs to be estimated again
+   * for the specified magnitudes, in which case they become
+   * the new reference for the subsequent frames.
+   **/
+  bool update(const voyx::vector<T> magnitudes)
+  {
+    voyxprofile("EnvelopeCache::update");
+
+    const size_t size = (magnitudes.size() + decimation - 1) / decimation;
+
+    if (size != reference.size())
+    {
+      bands.resize(size);
+      reference.resize(size);
+      age = staleness;
+    }
+
+    T sum = 0;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      const size_t begin = i * decimation;
+      const size_t end = std::min(begin + decimation, magnitudes.size());
+
+      T band = 0;
+
+      for (size_t j = begin; j < end; ++j)
+      {
+        band += magnitudes[j];
+      }
+
+      bands[i] = band;
+      sum += band;
+    }
+
+    const T norm = (sum > 0) ? 1 / sum : 0;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      bands[i] *= norm;
+    }
+
+    if (age < staleness)
+    {
+      T flux = 0;
+
+      for (size_t i = 0; i < size; ++i)
+      {
+        flux += std::abs(bands[i] - reference[i]);
+      }
+
+      if (flux / 2 < threshold)
+      {
+        ++age;
+        return false;
+      }
+    }
+
+    std::swap(bands, reference);
+    age = 0;
+    return true;
+  }
+
+  /**
+   * Enforces the envelope estimation on the next update.
+   **/
+  void reset()
+  {
+    age = staleness;
+  }
+
+private:
+
+  const double threshold;
+  const size_t staleness;
+  const size_t decimation;
+
+  std::vector<T> bands;
+  std::vector<T> reference;
+
+  size_t age = 0;
+
+};
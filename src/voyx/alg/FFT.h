@@ -1,20 +1,56 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Profiler.h>
 
 #include <pocketfft_hdronly.h>
 
+#ifdef VOYXFFTW
+#include <fftw3.h>
+#endif
+
+enum class FFTBackend
+{
+  Auto,
+  PocketFFT,
+  Radix2,
+  FFTW
+};
+
+/**
+ * Real-valued FFT with a persistent plan, which is created once
+ * at construction by one of the available backends:
+ *
+ * - PocketFFT, a precomputed pocketfft plan for arbitrary sizes,
+ * - Radix2, an in-tree real FFT via a half-size complex radix-2 FFT,
+ *   which requires a power of two framesize,
+ * - FFTW, if built with the optional FFTW library.
+ *
+ * The Auto backend times each applicable candidate once per
+ * framesize and reuses the fastest one afterwards.
+ *
+ * Unlike the other backends, pocketfft allocates its scratch buffer
+ * in each call and does not accept a preallocated one. So the Auto
+ * backend only falls back to PocketFFT if neither Radix2 nor FFTW
+ * is applicable, i.e. realtime use with the allocation guard
+ * requires a power of two framesize or the FFTW backend.
+ *
+ * The forward transform is normalized by 1/framesize.
+ * The internal scratch buffers make a single instance
+ * unsuitable for concurrent use.
+ **/
 template<typename T>
 class FFT
 {
 
 public:
 
-  FFT(const size_t framesize) :
+  FFT(const size_t framesize, const FFTBackend backend = FFTBackend::Auto) :
     fullsize(framesize),
-    halfsize(framesize / 2 + /* nyquist */ 1)
+    halfsize(framesize / 2 + /* nyquist */ 1),
+    plan(create(framesize, (backend == FFTBackend::Auto) ? autotune(framesize) : backend))
   {
-    voyxassert(framesize && !(framesize & (framesize - 1))); // power of two
+    voyxassert(framesize > 1);
   }
 
   size_t framesize() const
@@ -27,76 +63,73 @@ public:
     return halfsize;
   }
 
-  void fft(const voyx::vector<T> samples, voyx::vector<std::complex<T>> dft) const
+  FFTBackend backend() const
+  {
+    return plan->backend();
+  }
+
+  static bool available(const FFTBackend backend, const size_t framesize)
+  {
+    switch (backend)
+    {
+      case FFTBackend::Auto:
+      case FFTBackend::PocketFFT:
+        return true;
+      case FFTBackend::Radix2:
+        return framesize >= 4 && !(framesize & (framesize - 1));
+      case FFTBackend::FFTW:
+        #ifdef VOYXFFTW
+        return true;
+        #else
+        return false;
+        #endif
+    }
+
+    return false;
+  }
+
+  void fft(const voyx::vector<T> samples, voyx::vector<std::complex<T>> dft)
   {
     voyxassert(samples.size() == framesize());
     voyxassert(dft.size() == dftsize());
 
-    pocketfft::r2c(
-      { samples.size() },
-      { sizeof(T) },
-      { sizeof(std::complex<T>) },
-      0,
-      true,
-      samples.data(),
-      dft.data(),
-      T(1) / samples.size());
+    plan->fft(samples.data(), dft.data());
   }
 
-  void fft(const voyx::matrix<T> samples, voyx::matrix<std::complex<T>> dfts) const
+  void fft(const voyx::matrix<T> samples, voyx::matrix<std::complex<T>> dfts)
   {
+    voyxprofile("FFT::fft");
+
     voyxassert(samples.size() == dfts.size());
     voyxassert(samples.stride() == framesize());
     voyxassert(dfts.stride() == dftsize());
 
-    const ptrdiff_t X = samples.stride() * sizeof(T);
-    const ptrdiff_t Y = dfts.stride() * sizeof(std::complex<T>);
-
-    pocketfft::r2c(
-      { samples.stride(), samples.size() },
-      { sizeof(T), X },
-      { sizeof(std::complex<T>), Y },
-      0,
-      true,
-      samples.data(),
-      dfts.data(),
-      T(1) / samples.stride());
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+      plan->fft(samples[i].data(), dfts[i].data());
+    }
   }
 
-  void ifft(const voyx::vector<std::complex<T>> dft, voyx::vector<T> samples) const
+  void ifft(const voyx::vector<std::complex<T>> dft, voyx::vector<T> samples)
   {
     voyxassert(samples.size() == framesize());
     voyxassert(dft.size() == dftsize());
 
-    pocketfft::c2r(
-      { samples.size() },
-      { sizeof(std::complex<T>) },
-      { sizeof(T) },
-      0,
-      false,
-      dft.data(),
-      samples.data(),
-      T(1));
+    plan->ifft(dft.data(), samples.data());
   }
 
-  void ifft(const voyx::matrix<std::complex<T>> dfts, voyx::matrix<T> samples) const
+  void ifft(const voyx::matrix<std::complex<T>> dfts, voyx::matrix<T> samples)
   {
+    voyxprofile("FFT::ifft");
+
     voyxassert(samples.size() == dfts.size());
     voyxassert(samples.stride() == framesize());
     voyxassert(dfts.stride() == dftsize());
 
-    const ptrdiff_t X = dfts.stride() * sizeof(std::complex<T>);
-    const ptrdiff_t Y = samples.stride() * sizeof(T);
-
-    pocketfft::c2r(
-      { samples.stride(), samples.size() },
-      { sizeof(std::complex<T>), X },
-      { sizeof(T), Y },
-      0,
-      false,
-      dfts.data(),
-      samples.data(),
-      T(1));
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+      plan->ifft(dfts[i].data(), samples[i].data());
+    }
   }
 
 private:
@@ -104,4 +137,437 @@ private:
   const size_t fullsize;
   const size_t halfsize;
 
+  class Plan
+  {
+
+  public:
+
+    virtual ~Plan() {}
+
+    virtual FFTBackend backend() const = 0;
+
+    virtual void fft(const T* samples, std::complex<T>* dft) = 0;
+    virtual void ifft(const std::complex<T>* dft, T* samples) = 0;
+
+  };
+
+  class PocketPlan : public Plan
+  {
+
+  public:
+
+    PocketPlan(const size_t framesize) :
+      plan(framesize),
+      buffer(framesize)
+    {
+    }
+
+    FFTBackend backend() const override
+    {
+      return FFTBackend::PocketFFT;
+    }
+
+    void fft(const T* samples, std::complex<T>* dft) override
+    {
+      const size_t n = buffer.size();
+
+      std::copy(samples, samples + n, buffer.begin());
+
+      plan.exec(buffer.data(), T(1) / n, true);
+
+      // unpack r0, r1, i1, r2, i2, ..., [rn/2]
+      dft[0] = { buffer[0], 0 };
+
+      size_t i = 1, j = 1;
+
+      for (; i < n - 1; i += 2, ++j)
+      {
+        dft[j] = { buffer[i], buffer[i + 1] };
+      }
+
+      if (i < n)
+      {
+        dft[j] = { buffer[i], 0 };
+      }
+    }
+
+    void ifft(const std::complex<T>* dft, T* samples) override
+    {
+      const size_t n = buffer.size();
+
+      buffer[0] = dft[0].real();
+
+      size_t i = 1, j = 1;
+
+      for (; i < n - 1; i += 2, ++j)
+      {
+        buffer[i] = dft[j].real();
+        buffer[i + 1] = dft[j].imag();
+      }
+
+      if (i < n)
+      {
+        buffer[i] = dft[j].real();
+      }
+
+      plan.exec(buffer.data(), T(1), false);
+
+      std::copy(buffer.begin(), buffer.end(), samples);
+    }
+
+  private:
+
+    const pocketfft::detail::pocketfft_r<T> plan;
+    std::vector<T> buffer;
+
+  };
+
+  class Radix2Plan : public Plan
+  {
+
+  public:
+
+    Radix2Plan(const size_t framesize) :
+      n(framesize),
+      m(framesize / 2),
+      buffer(framesize / 2),
+      twiddles(framesize / 4),
+      unpacking(framesize / 2 + 1),
+      reversal(framesize / 2)
+    {
+      voyxassert(framesize >= 4 && !(framesize & (framesize - 1)));
+
+      const double pi = std::acos(-1.0);
+
+      for (size_t i = 0; i < twiddles.size(); ++i)
+      {
+        twiddles[i] = std::polar(1.0, -2 * pi * i / m);
+      }
+
+      for (size_t i = 0; i < unpacking.size(); ++i)
+      {
+        unpacking[i] = std::polar(1.0, -2 * pi * i / n);
+      }
+
+      const size_t bits = static_cast<size_t>(std::countr_zero(m));
+
+      for (size_t i = 0; i < m; ++i)
+      {
+        size_t j = 0;
+
+        for (size_t bit = 0; bit < bits; ++bit)
+        {
+          j |= ((i >> bit) & 1) << (bits - 1 - bit);
+        }
+
+        reversal[i] = j;
+      }
+    }
+
+    FFTBackend backend() const override
+    {
+      return FFTBackend::Radix2;
+    }
+
+    void fft(const T* samples, std::complex<T>* dft) override
+    {
+      // pack even and odd samples into a half-size complex signal
+      for (size_t i = 0; i < m; ++i)
+      {
+        buffer[reversal[i]] = { samples[i * 2], samples[i * 2 + 1] };
+      }
+
+      transform(false);
+
+      const T scale = T(1) / n;
+      const T half = T(0.5);
+
+      for (size_t k = 0; k <= m; ++k)
+      {
+        const std::complex<T> a = buffer[k % m];
+        const std::complex<T> b = std::conj(buffer[(m - k) % m]);
+
+        const std::complex<T> even = (a + b) * half;
+        const std::complex<T> odd = (a - b) * std::complex<T>(0, -half);
+
+        dft[k] = (even + odd * w(k)) * scale;
+      }
+    }
+
+    void ifft(const std::complex<T>* dft, T* samples) override
+    {
+      auto get = [&](const size_t k)
+      {
+        return (k == 0 || k == m) ? std::complex<T>(dft[k].real(), 0) : dft[k];
+      };
+
+      for (size_t k = 0; k < m; ++k)
+      {
+        const std::complex<T> a = get(k);
+        const std::complex<T> b = std::conj(get(m - k));
+
+        const std::complex<T> even = a + b;
+        const std::complex<T> odd = (a - b) * std::conj(w(k));
+
+        buffer[reversal[k]] = even + odd * std::complex<T>(0, 1);
+      }
+
+      transform(true);
+
+      for (size_t i = 0; i < m; ++i)
+      {
+        samples[i * 2] = buffer[i].real();
+        samples[i * 2 + 1] = buffer[i].imag();
+      }
+    }
+
+  private:
+
+    const size_t n;
+    const size_t m;
+
+    std::vector<std::complex<T>> buffer;
+    std::vector<std::complex<double>> twiddles;
+    std::vector<std::complex<double>> unpacking;
+    std::vector<size_t> reversal;
+
+    std::complex<T> w(const size_t k) const
+    {
+      return std::complex<T>(unpacking[k]);
+    }
+
+    void transform(const bool inverse)
+    {
+      for (size_t size = 2; size <= m; size *= 2)
+      {
+        const size_t half = size / 2;
+        const size_t step = m / size;
+
+        for (size_t i = 0; i < m; i += size)
+        {
+          for (size_t j = 0; j < half; ++j)
+          {
+            const std::complex<double> twiddle = twiddles[j * step];
+            const std::complex<T> factor(twiddle.real(), inverse ? -twiddle.imag() : twiddle.imag());
+
+            const std::complex<T> a = buffer[i + j];
+            const std::complex<T> b = buffer[i + j + half] * factor;
+
+            buffer[i + j] = a + b;
+            buffer[i + j + half] = a - b;
+          }
+        }
+      }
+    }
+
+  };
+
+  #ifdef VOYXFFTW
+  class FftwPlan : public Plan
+  {
+
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value);
+
+    using complex_t = std::conditional_t<std::is_same<T, float>::value, fftwf_complex, fftw_complex>;
+    using plan_t = std::conditional_t<std::is_same<T, float>::value, fftwf_plan, fftw_plan>;
+
+  public:
+
+    FftwPlan(const size_t framesize) :
+      n(framesize)
+    {
+      // the FFTW planner is not thread-safe
+      static std::mutex mutex;
+      std::lock_guard lock(mutex);
+
+      const int size = static_cast<int>(framesize);
+
+      if constexpr (std::is_same<T, float>::value)
+      {
+        samples = fftwf_alloc_real(framesize);
+        dft = fftwf_alloc_complex(framesize / 2 + 1);
+        forward = fftwf_plan_dft_r2c_1d(size, samples, dft, FFTW_MEASURE);
+        backward = fftwf_plan_dft_c2r_1d(size, dft, samples, FFTW_MEASURE);
+      }
+      else
+      {
+        samples = fftw_alloc_real(framesize);
+        dft = fftw_alloc_complex(framesize / 2 + 1);
+        forward = fftw_plan_dft_r2c_1d(size, samples, dft, FFTW_MEASURE);
+        backward = fftw_plan_dft_c2r_1d(size, dft, samples, FFTW_MEASURE);
+      }
+    }
+
+    ~FftwPlan()
+    {
+      if constexpr (std::is_same<T, float>::value)
+      {
+        fftwf_destroy_plan(forward);
+        fftwf_destroy_plan(backward);
+        fftwf_free(samples);
+        fftwf_free(dft);
+      }
+      else
+      {
+        fftw_destroy_plan(forward);
+        fftw_destroy_plan(backward);
+        fftw_free(samples);
+        fftw_free(dft);
+      }
+    }
+
+    FFTBackend backend() const override
+    {
+      return FFTBackend::FFTW;
+    }
+
+    void fft(const T* input, std::complex<T>* output) override
+    {
+      std::copy(input, input + n, samples);
+
+      if constexpr (std::is_same<T, float>::value)
+      {
+        fftwf_execute(forward);
+      }
+      else
+      {
+        fftw_execute(forward);
+      }
+
+      const T scale = T(1) / n;
+
+      for (size_t i = 0; i < n / 2 + 1; ++i)
+      {
+        output[i] = { dft[i][0] * scale, dft[i][1] * scale };
+      }
+    }
+
+    void ifft(const std::complex<T>* input, T* output) override
+    {
+      for (size_t i = 0; i < n / 2 + 1; ++i)
+      {
+        dft[i][0] = input[i].real();
+        dft[i][1] = input[i].imag();
+      }
+
+      if constexpr (std::is_same<T, float>::value)
+      {
+        fftwf_execute(backward);
+      }
+      else
+      {
+        fftw_execute(backward);
+      }
+
+      std::copy(samples, samples + n, output);
+    }
+
+  private:
+
+    const size_t n;
+
+    T* samples;
+    complex_t* dft;
+
+    plan_t forward;
+    plan_t backward;
+
+  };
+  #endif
+
+  const std::unique_ptr<Plan> plan;
+
+  static std::unique_ptr<Plan> create(const size_t framesize, const FFTBackend backend)
+  {
+    if (!available(backend, framesize))
+    {
+      throw std::runtime_error(
+        "The requested FFT backend is not available for the specified framesize!");
+    }
+
+    switch (backend)
+    {
+      case FFTBackend::Radix2:
+        return std::make_unique<Radix2Plan>(framesize);
+      #ifdef VOYXFFTW
+      case FFTBackend::FFTW:
+        return std::make_unique<FftwPlan>(framesize);
+      #endif
+      default:
+        return std::make_unique<PocketPlan>(framesize);
+    }
+  }
+
+  static FFTBackend autotune(const size_t framesize)
+  {
+    static std::mutex mutex;
+    static std::map<size_t, FFTBackend> backends;
+
+    std::lock_guard lock(mutex);
+
+    if (backends.count(framesize))
+    {
+      return backends.at(framesize);
+    }
+
+    std::vector<T> samples(framesize);
+    std::vector<std::complex<T>> dft(framesize / 2 + 1);
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<T> distribution(-1, 1);
+
+    for (auto& sample : samples)
+    {
+      sample = distribution(generator);
+    }
+
+    // roughly the same amount of work for each framesize
+    const size_t iterations = std::max<size_t>((size_t(1) << 20) / framesize, 8);
+
+    FFTBackend best = FFTBackend::PocketFFT;
+    double besttime = std::numeric_limits<double>::max();
+
+    // prefer the backends which do not allocate per call
+    const bool fallback = !available(FFTBackend::Radix2, framesize) &&
+                          !available(FFTBackend::FFTW, framesize);
+
+    for (const auto candidate : { FFTBackend::PocketFFT, FFTBackend::Radix2, FFTBackend::FFTW })
+    {
+      if (!available(candidate, framesize))
+      {
+        continue;
+      }
+
+      if (candidate == FFTBackend::PocketFFT && !fallback)
+      {
+        continue;
+      }
+
+      auto plan = create(framesize, candidate);
+
+      plan->fft(samples.data(), dft.data());
+      plan->ifft(dft.data(), samples.data());
+
+      const auto timestamp = std::chrono::steady_clock::now();
+
+      for (size_t i = 0; i < iterations; ++i)
+      {
+        plan->fft(samples.data(), dft.data());
+        plan->ifft(dft.data(), samples.data());
+      }
+
+      const double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - timestamp).count();
+
+      if (time < besttime)
+      {
+        best = candidate;
+        besttime = time;
+      }
+    }
+
+    backends[framesize] = best;
+
+    return best;
+  }
+
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Profiler.h>
 
 template<typename T>
 class FIR
@@ -30,6 +31,8 @@ public:
 
   void operator()(const voyx::vector<T> input, voyx::vector<T> output)
   {
+    voyxprofile("FIR::filter");
+
     voyxassert(input.size() == output.size());
 
     for (size_t i = 0; i < input.size(); ++i)
@@ -38,6 +41,73 @@ public:
     }
   }
 
+  /**
+   * Filters the input block regardless of the internal state and keeps
+   * every factor-th output, starting with the first one which does not
+   * depend on samples preceding the block.
+   **/
+  void decimate(const voyx::vector<T> input, voyx::vector<T> output, const size_t factor) const
+  {
+    voyxprofile("FIR::decimate");
+
+    voyxassert(factor > 0);
+    voyxassert(b.size() + (output.size() - 1) * factor <= input.size());
+
+    const size_t taps = b.size();
+
+    for (size_t i = 0; i < output.size(); ++i)
+    {
+      // the coefficients are applied in reverse order
+      const T* x = input.data() + i * factor + (taps - 1);
+
+      T y = T(0);
+
+      for (size_t j = 0; j < taps; ++j)
+      {
+        y += b[j] * x[-ptrdiff_t(j)];
+      }
+
+      output[i] = y;
+    }
+  }
+
+  /**
+   * Designs a linear phase lowpass by the Blackman windowed sinc,
+   * with the cutoff frequency relative to the sample rate.
+   **/
+  static std::vector<T> lowpass(const double cutoff, const size_t taps)
+  {
+    voyxassert(cutoff > 0 && cutoff < 0.5);
+    voyxassert(taps > 2);
+
+    const double pi = std::acos(-1.0);
+    const double center = (taps - 1) / 2.0;
+
+    std::vector<double> values(taps);
+
+    for (size_t i = 0; i < taps; ++i)
+    {
+      const double t = i - center;
+      const double w = 2 * pi * i / (taps - 1);
+
+      const double sinc = (t == 0) ? 2 * cutoff : std::sin(2 * pi * cutoff * t) / (pi * t);
+      const double window = 0.42 - 0.5 * std::cos(w) + 0.08 * std::cos(2 * w);
+
+      values[i] = sinc * window;
+    }
+
+    const double gain = std::accumulate(values.begin(), values.end(), 0.0);
+
+    std::vector<T> b(taps);
+
+    for (size_t i = 0; i < taps; ++i)
+    {
+      b[i] = static_cast<T>(values[i] / gain);
+    }
+
+    return b;
+  }
+
 private:
 
   const std::vector<T> b;
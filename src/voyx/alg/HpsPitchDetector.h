@@ -0,0 +1,153 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/etc/Convert.h>
+#include <voyx/etc/Profiler.h>
+
+/**
+ * Spectral pitch detection by the harmonic product spectrum
+ * of the magnitude spectrum, i.e. the product of the spectrum
+ * and its decimations by 2 to depth+1.
+ *
+ * The product peaks at the fundamental, even if the fundamental
+ * itself is weak, since all harmonics coincide there. Before that,
+ * each bin is replaced by the maximum of its neighbors, so that
+ * the higher harmonics are not missed between two bins. The peak bin
+ * is then refined by parabolic interpolation of each harmonic
+ * in the log magnitude spectrum, so the estimate benefits from
+ * the finer relative resolution of the higher harmonics.
+ *
+ * All buffers are preallocated, so the detection does not
+ * allocate and is cheap enough for every frame at high overlap.
+ *
+ * The lowest fundamental should span at least about eight bins,
+ * otherwise octave errors become likely. So for voice at 44.1 kHz
+ * the frame size should be 4096 or more.
+ **/
+template<typename T>
+class HpsPitchDetector
+{
+
+public:
+
+  HpsPitchDetector(const std::pair<double, double> roi, const double samplerate, const size_t framesize, const size_t depth = 4) :
+    roi(roi),
+    samplerate(samplerate),
+    framesize(framesize),
+    depth(depth),
+    spread(framesize / 2 + 1),
+    product(framesize / 2 + 1)
+  {
+    voyxassert(framesize > 3);
+  }
+
+  /**
+   * Returns the estimated frequency in hertz for the specified
+   * magnitude spectrum of framesize/2+1 bins, or zero if there
+   * is no spectral peak in the frequency range.
+   **/
+  double operator()(const voyx::vector<T> magnitudes)
+  {
+    voyxprofile("HpsPitchDetector::detect");
+
+    voyxassert(magnitudes.size() == product.size());
+
+    const size_t nmin = size_t(1);
+    const size_t nmax = magnitudes.size() - 2;
+
+    const size_t fmin = static_cast<size_t>(std::min(roi.first, roi.second) * framesize / samplerate);
+    const size_t fmax = static_cast<size_t>(std::ceil(std::max(roi.first, roi.second) * framesize / samplerate));
+
+    const size_t imin = std::clamp(fmin, nmin, nmax);
+    const size_t imax = std::clamp(fmax, nmin, nmax);
+
+    const size_t size = magnitudes.size();
+
+    spread[0] = std::max(magnitudes[0], magnitudes[1]);
+
+    for (size_t i = 1; i < size - 1; ++i)
+    {
+      spread[i] = std::max(std::max(magnitudes[i - 1], magnitudes[i]), magnitudes[i + 1]);
+    }
+
+    spread[size - 1] = std::max(magnitudes[size - 2], magnitudes[size - 1]);
+
+    $$::hpsmul<T>(spread, product, depth);
+
+    T value = 0;
+    size_t index = 0;
+
+    for (size_t i = imin; i <= imax; ++i)
+    {
+      if (product[i] > value)
+      {
+        value = product[i];
+        index = i;
+      }
+    }
+
+    if (index == 0)
+    {
+      return 0;
+    }
+
+    const T tiny = std::numeric_limits<T>::min();
+
+    double weights = 0;
+    double bins = 0;
+
+    for (size_t harmonic = 1; harmonic <= depth + 1; ++harmonic)
+    {
+      size_t j = index * harmonic;
+
+      if (j + 1 >= magnitudes.size())
+      {
+        break;
+      }
+
+      // the harmonic may be up to half a bin per harmonic number
+      // apart from the multiple of the coarse fundamental bin
+      for (size_t k = 0; k < harmonic / 2 + 1; ++k)
+      {
+        if (magnitudes[j + 1] > magnitudes[j] && j + 2 < magnitudes.size())
+        {
+          ++j;
+        }
+        else if (magnitudes[j - 1] > magnitudes[j] && j > 1)
+        {
+          --j;
+        }
+        else
+        {
+          break;
+        }
+      }
+
+      const T a = std::log(std::max(magnitudes[j - 1], tiny));
+      const T b = std::log(std::max(magnitudes[j], tiny));
+      const T c = std::log(std::max(magnitudes[j + 1], tiny));
+
+      const T curvature = a - 2 * b + c;
+      const T shift = (curvature < 0) ? std::clamp<T>((a - c) / (2 * curvature), T(-0.5), T(+0.5)) : 0;
+
+      // weight each harmonic by its resolution and magnitude
+      const double weight = double(harmonic) * magnitudes[j];
+
+      weights += weight * harmonic;
+      bins += weight * (j + shift);
+    }
+
+    return (weights > 0 ? bins / weights : index) * samplerate / framesize;
+  }
+
+private:
+
+  const std::pair<double, double> roi;
+  const double samplerate;
+  const size_t framesize;
+  const size_t depth;
+
+  std::vector<T> spread;
+  std::vector<T> product;
+
+};
@@ -0,0 +1,285 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/etc/Convert.Complex.h>
+#include <voyx/etc/Convert.Envelope.h>
+#include <voyx/etc/Lifting.h>
+#include <voyx/etc/Profiler.h>
+
+/**
+ * Spectral envelope estimation by linear prediction,
+ * as an alternative to the cepstral Lifter with the same
+ * lowpass, divide and multiply surface.
+ *
+ * The autocorrelation up to the prediction order is obtained
+ * directly from the power spectrum on the DFT grid, the Levinson-Durbin
+ * recursion yields the predictor coefficients, and the all-pole model
+ * E/|A|^2 is evaluated on the same grid. So both transforms only need
+ * order+1 precomputed cosine and sine rows, i.e. neither FFTs
+ * nor per-bin log and pow.
+ *
+ * The autocorrelation and the recursion are computed in double
+ * precision, since the model resolves a spectral dynamic range
+ * far beyond the single precision accumulation error.
+ *
+ * The prediction order should be about samplerate/1e3 for voice,
+ * typically 20 to 40 at common sample rates.
+ **/
+template<typename T>
+class LPC
+{
+
+public:
+
+  LPC(const size_t order, const size_t framesize) :
+    order(order),
+    framesize(framesize),
+    dftsize(framesize / 2 + 1),
+    autocosines((order + 1) * dftsize),
+    cosines((order + 1) * dftsize),
+    sines((order + 1) * dftsize),
+    powers(dftsize),
+    lags(order + 1),
+    coeffs(order + 1),
+    buffer(order + 1),
+    values(dftsize),
+    response(dftsize),
+    quadrature(dftsize),
+    predictor(order + 1)
+  {
+    voyxassert(framesize > 1);
+    voyxassert(order > 0 && order < framesize);
+
+    const double pi = std::acos(-1.0);
+
+    for (size_t i = 0; i <= order; ++i)
+    {
+      for (size_t j = 0; j < dftsize; ++j)
+      {
+        // reduce the argument exactly before the conversion
+        const size_t k = (i * j) % framesize;
+
+        const double cosine = std::cos(2 * pi * k / framesize);
+        const double sine = std::sin(2 * pi * k / framesize);
+
+        autocosines[i * dftsize + j] = cosine;
+        cosines[i * dftsize + j] = static_cast<T>(cosine);
+        sines[i * dftsize + j] = static_cast<T>(sine);
+      }
+    }
+  }
+
+  std::vector<T> lowpass(const voyx::vector<T>& dft)
+  {
+    std::vector<T> envelope(dft.size());
+    lowpass(dft, envelope);
+    return envelope;
+  }
+
+  void lowpass(const voyx::vector<T> dft, voyx::vector<T> envelope)
+  {
+    lowpass<$$::real>(dft, envelope, nullptr);
+  }
+
+  template<typename value_getter_t>
+  std::vector<T> lowpass(const voyx::vector<std::complex<T>> dft)
+  {
+    std::vector<T> envelope(dft.size());
+    lowpass<value_getter_t>(dft, envelope);
+    return envelope;
+  }
+
+  template<typename value_getter_t>
+  void lowpass(const voyx::vector<std::complex<T>> dft, voyx::vector<T> envelope)
+  {
+    lowpass<value_getter_t>(dft, envelope, nullptr);
+  }
+
+  template<typename value_getter_t, typename V>
+  void lowpass(const voyx::vector<V> dft, voyx::vector<T> envelope, voyx::vector<T> logspectrum)
+  {
+    voyxassert(logspectrum.size() >= dft.size());
+
+    lowpass<value_getter_t>(dft, envelope, logspectrum.data());
+  }
+
+  void divide(voyx::vector<T> values, const voyx::vector<T> envelope) const
+  {
+    voyxprofile("LPC::divide");
+
+    $$::envdiv(values, envelope);
+  }
+
+  void multiply(voyx::vector<T> values, const voyx::vector<T> envelope) const
+  {
+    voyxprofile("LPC::multiply");
+
+    $$::envmul(values, envelope);
+  }
+
+  template<typename value_getter_setter_t>
+  void divide(voyx::vector<std::complex<T>> dft, const voyx::vector<T> envelope) const
+  {
+    voyxprofile("LPC::divide");
+
+    $$::envdiv<value_getter_setter_t>(dft, envelope);
+  }
+
+  template<typename value_getter_setter_t>
+  void multiply(voyx::vector<std::complex<T>> dft, const voyx::vector<T> envelope) const
+  {
+    voyxprofile("LPC::multiply");
+
+    $$::envmul<value_getter_setter_t>(dft, envelope);
+  }
+
+private:
+
+  const size_t order;
+  const size_t framesize;
+  const size_t dftsize;
+
+  std::vector<double> autocosines;
+  std::vector<T> cosines;
+  std::vector<T> sines;
+
+  std::vector<double> powers;
+  std::vector<double> lags;
+  std::vector<double> coeffs;
+  std::vector<double> buffer;
+
+  std::vector<T> values;
+  std::vector<T> response;
+  std::vector<T> quadrature;
+  std::vector<T> predictor;
+
+  /**
+   * Estimates the spectral envelope as the magnitude response
+   * of the all-pole model, excluding the DC and Nyquist bins
+   * just like the Lifter does.
+   **/
+  template<typename value_getter_t, typename V>
+  void lowpass(const voyx::vector<V> dft, voyx::vector<T> envelope, T* logspectrum)
+  {
+    voyxprofile("LPC::lowpass");
+
+    const value_getter_t getvalue;
+
+    const size_t size = dft.size();
+
+    voyxassert(size == envelope.size());
+    voyxassert(size <= dftsize);
+
+    if (size < 3)
+    {
+      return;
+    }
+
+    // one-sided power spectrum weighted by its multiplicity
+    // on the full circle and the 1/N of the inverse transform
+    const double weight = 2.0 / framesize;
+
+    powers[0] = 0;
+
+    for (size_t i = 1; i < size - 1; ++i)
+    {
+      const T value = getvalue(dft[i]);
+
+      values[i] = value;
+      powers[i] = double(value) * double(value) * weight;
+    }
+
+    powers[size - 1] = 0;
+
+    if (logspectrum != nullptr)
+    {
+      voyx::lifting::log10(values.data() + 1, logspectrum + 1, size - 2);
+    }
+
+    voyx::lifting::project(autocosines.data(), powers.data(), lags.data(), order + 1, size, dftsize);
+
+    const double error = levinson();
+
+    if (!(error > 0))
+    {
+      std::fill(envelope.data() + 1, envelope.data() + (size - 1), T(0));
+      return;
+    }
+
+    for (size_t k = 0; k <= order; ++k)
+    {
+      predictor[k] = static_cast<T>(coeffs[k]);
+    }
+
+    // evaluate A instead of the cosine series of |A|^2,
+    // which would cancel out in single precision at the peaks
+    voyx::lifting::superpose(cosines.data(), predictor.data(), response.data(), order + 1, size, dftsize);
+    voyx::lifting::superpose(sines.data(), predictor.data(), quadrature.data(), order + 1, size, dftsize);
+
+    const T gain = static_cast<T>(error);
+    const T tiny = std::numeric_limits<T>::min();
+
+    for (size_t i = 1; i < size - 1; ++i)
+    {
+      const T power = response[i] * response[i] + quadrature[i] * quadrature[i];
+
+      envelope[i] = std::sqrt(gain / std::max(power, tiny));
+    }
+  }
+
+  /**
+   * Solves the normal equations for the predictor coefficients
+   * with a white noise correction of -90 dB, which only affects
+   * the deepest spectral valleys but keeps the recursion stable.
+   * Returns the prediction error or zero for a degenerate input.
+   **/
+  double levinson()
+  {
+    const double energy = lags[0] * (1 + 1e-9);
+
+    if (!(energy > 0))
+    {
+      return 0;
+    }
+
+    double error = energy;
+
+    std::fill(coeffs.begin(), coeffs.end(), 0.0);
+
+    coeffs[0] = 1;
+
+    for (size_t i = 1; i <= order; ++i)
+    {
+      double acc = lags[i];
+
+      for (size_t j = 1; j < i; ++j)
+      {
+        acc += coeffs[j] * lags[i - j];
+      }
+
+      const double k = -acc / error;
+
+      for (size_t j = 1; j < i; ++j)
+      {
+        buffer[j] = coeffs[j] + k * coeffs[i - j];
+      }
+
+      for (size_t j = 1; j < i; ++j)
+      {
+        coeffs[j] = buffer[j];
+      }
+
+      coeffs[i] = k;
+
+      error *= 1 - k * k;
+
+      if (!(error > 0))
+      {
+        return 0;
+      }
+    }
+
+    return error;
+  }
+
+};
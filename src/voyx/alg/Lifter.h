@@ -2,6 +2,10 @@
 
 #include <voyx/Header.h>
 #include <voyx/alg/FFT.h>
+#include <voyx/etc/Convert.Complex.h>
+#include <voyx/etc/Convert.Envelope.h>
+#include <voyx/etc/Lifting.h>
+#include <voyx/etc/Profiler.h>
 
 template<typename T>
 class Lifter
@@ -14,8 +18,42 @@ public:
     quefrency(static_cast<size_t>(quefrency * samplerate)),
     fft(framesize),
     spectrum(fft.dftsize()),
-    cepstrum(fft.framesize())
+    cepstrum(fft.framesize()),
+    logs(fft.dftsize())
   {
+    const size_t rows = this->quefrency + 1;
+    const size_t cols = fft.dftsize();
+
+    // prefer the truncated cosine transform if it needs less multiply-adds
+    // than the complex FFT round trip, which is the case for short lifters
+    const double cost = 2.0 * rows * cols;
+    const double budget = 2.0 * 5 * fft.framesize() * std::log2(fft.framesize());
+
+    if (rows < cols && cost < budget)
+    {
+      const double pi = std::acos(-1.0);
+
+      cosines.resize(rows * cols);
+      weights.resize(rows);
+      quefrencies.resize(rows);
+
+      for (size_t i = 0; i < rows; ++i)
+      {
+        for (size_t j = 0; j < cols; ++j)
+        {
+          // reduce the argument exactly before the conversion
+          const size_t k = (i * j) % fft.framesize();
+
+          cosines[i * cols + j] = static_cast<T>(std::cos(2 * pi * k / fft.framesize()));
+        }
+
+        // the one-sided lifter window of lowpass(cepstrum, quefrency),
+        // the factor 2 of the even cepstrum and the 1/N of the forward FFT
+        const double window = (i == 0 || i == this->quefrency) ? 1 : 2;
+
+        weights[i] = static_cast<T>(2 * window / fft.framesize());
+      }
+    }
   }
 
   std::vector<T> lowpass(const voyx::vector<T>& dft)
@@ -27,23 +65,7 @@ public:
 
   void lowpass(const voyx::vector<T> dft, voyx::vector<T> envelope)
   {
-    voyxassert(dft.size() == envelope.size());
-
-    for (size_t i = 1; i < dft.size() - 1; ++i)
-    {
-      const T value = dft[i];
-
-      spectrum[i] = value ? std::log10(value) : -12;
-    }
-
-    fft.ifft(spectrum, cepstrum);
-    lowpass(cepstrum, quefrency);
-    fft.fft(cepstrum, spectrum);
-
-    for (size_t i = 1; i < dft.size() - 1; ++i)
-    {
-      envelope[i] = std::pow(T(10), spectrum[i].real());
-    }
+    lowpass<$$::real>(dft, envelope, nullptr, nullptr);
   }
 
   template<typename value_getter_t>
@@ -57,81 +79,54 @@ public:
   template<typename value_getter_t>
   void lowpass(const voyx::vector<std::complex<T>> dft, voyx::vector<T> envelope)
   {
-    const value_getter_t getvalue;
-
-    voyxassert(dft.size() == envelope.size());
-
-    for (size_t i = 1; i < dft.size() - 1; ++i)
-    {
-      const T value = getvalue(dft[i]);
-
-      spectrum[i] = value ? std::log10(value) : -12;
-    }
+    lowpass<value_getter_t>(dft, envelope, nullptr, nullptr);
+  }
 
-    fft.ifft(spectrum, cepstrum);
-    lowpass(cepstrum, quefrency);
-    fft.fft(cepstrum, spectrum);
+  template<typename value_getter_t, typename V>
+  void lowpass(const voyx::vector<V> dft, voyx::vector<T> envelope, voyx::vector<T> logspectrum)
+  {
+    voyxassert(logspectrum.size() >= dft.size());
 
-    for (size_t i = 1; i < dft.size() - 1; ++i)
-    {
-      envelope[i] = std::pow(T(10), spectrum[i].real());
-    }
+    lowpass<value_getter_t>(dft, envelope, logspectrum.data(), nullptr);
   }
 
-  template<typename value_getter_t>
-  void lowpass(const voyx::vector<std::complex<T>> dft, voyx::vector<T> envelope, voyx::vector<T> logspectrum, voyx::vector<T> logcepstrum)
+  template<typename value_getter_t, typename V>
+  void lowpass(const voyx::vector<V> dft, voyx::vector<T> envelope, voyx::vector<T> logspectrum, voyx::vector<T> logcepstrum)
   {
-    const value_getter_t getvalue;
-
-    voyxassert(dft.size() == envelope.size());
+    voyxassert(logspectrum.size() >= dft.size());
     voyxassert(logcepstrum.size() == cepstrum.size());
 
-    for (size_t i = 1; i < dft.size() - 1; ++i)
-    {
-      const T value = getvalue(dft[i]);
-
-      spectrum[i] = value ? std::log10(value) : -12;
-
-      logspectrum[i] = spectrum[i].real();
-    }
+    lowpass<value_getter_t>(dft, envelope, logspectrum.data(), logcepstrum.data());
+  }
 
-    fft.ifft(spectrum, cepstrum);
+  void divide(voyx::vector<T> values, const voyx::vector<T> envelope) const
+  {
+    voyxprofile("Lifter::divide");
 
-    logcepstrum = cepstrum;
-    lowpass(cepstrum, quefrency);
+    $$::envdiv(values, envelope);
+  }
 
-    fft.fft(cepstrum, spectrum);
+  void multiply(voyx::vector<T> values, const voyx::vector<T> envelope) const
+  {
+    voyxprofile("Lifter::multiply");
 
-    for (size_t i = 1; i < dft.size() - 1; ++i)
-    {
-      envelope[i] = std::pow(T(10), spectrum[i].real());
-    }
+    $$::envmul(values, envelope);
   }
 
   template<typename value_getter_setter_t>
   void divide(voyx::vector<std::complex<T>> dft, const voyx::vector<T> envelope) const
   {
-    const value_getter_setter_t value;
-
-    for (size_t i = 0; i < dft.size(); ++i)
-    {
-      const bool ok = std::isnormal(envelope[i]);
+    voyxprofile("Lifter::divide");
 
-      value(dft[i], ok ? value(dft[i]) / envelope[i] : 0);
-    }
+    $$::envdiv<value_getter_setter_t>(dft, envelope);
   }
 
   template<typename value_getter_setter_t>
   void multiply(voyx::vector<std::complex<T>> dft, const voyx::vector<T> envelope) const
   {
-    const value_getter_setter_t value;
-
-    for (size_t i = 0; i < dft.size(); ++i)
-    {
-      const bool ok = std::isnormal(envelope[i]);
+    voyxprofile("Lifter::multiply");
 
-      value(dft[i], ok ? value(dft[i]) * envelope[i] : 0);
-    }
+    $$::envmul<value_getter_setter_t>(dft, envelope);
   }
 
 private:
@@ -139,10 +134,97 @@ private:
   const double samplerate;
   const size_t quefrency;
 
-  const FFT<T> fft;
+  FFT<T> fft;
 
   std::vector<std::complex<T>> spectrum;
   std::vector<T> cepstrum;
+  std::vector<T> logs;
+
+  std::vector<T> cosines;
+  std::vector<T> weights;
+  std::vector<T> quefrencies;
+
+  /**
+   * Estimates the spectral envelope in the log10 domain.
+   *
+   * Since the log spectrum is real and even, so is its cepstrum,
+   * and the lifter only keeps the first quefrencies. So both transforms
+   * reduce to a truncated cosine transform over the precomputed cosines,
+   * unless the full cepstrum is requested or the lifter is too long.
+   **/
+  template<typename value_getter_t, typename V>
+  void lowpass(const voyx::vector<V> dft, voyx::vector<T> envelope, T* logspectrum, T* logcepstrum)
+  {
+    voyxprofile("Lifter::lowpass");
+
+    const value_getter_t getvalue;
+
+    const size_t size = dft.size();
+
+    voyxassert(size == envelope.size());
+    voyxassert(size <= logs.size());
+
+    if (size < 3)
+    {
+      return;
+    }
+
+    logs[0] = 0;
+
+    for (size_t i = 1; i < size - 1; ++i)
+    {
+      logs[i] = getvalue(dft[i]);
+    }
+
+    std::fill(logs.begin() + (size - 1), logs.end(), T(0));
+
+    voyx::lifting::log10(logs.data() + 1, logs.data() + 1, size - 2);
+
+    if (logspectrum != nullptr)
+    {
+      std::copy(logs.begin() + 1, logs.begin() + (size - 1), logspectrum + 1);
+    }
+
+    if (!cosines.empty() && logcepstrum == nullptr)
+    {
+      const size_t rows = quefrencies.size();
+      const size_t cols = logs.size();
+
+      voyx::lifting::project(cosines.data(), logs.data(), quefrencies.data(), rows, size, cols);
+
+      for (size_t i = 0; i < rows; ++i)
+      {
+        quefrencies[i] *= weights[i];
+      }
+
+      voyx::lifting::superpose(cosines.data(), quefrencies.data(), logs.data(), rows, size, cols);
+    }
+    else
+    {
+      for (size_t i = 0; i < spectrum.size(); ++i)
+      {
+        spectrum[i] = logs[i];
+      }
+
+      fft.ifft(spectrum, cepstrum);
+
+      if (logcepstrum != nullptr)
+      {
+        std::copy(cepstrum.begin(), cepstrum.end(), logcepstrum);
+      }
+
+      lowpass(cepstrum, quefrency);
+
+      fft.fft(cepstrum, spectrum);
+
+      for (size_t i = 0; i < size; ++i)
+      {
+        logs[i] = spectrum[i].real();
+      }
+    }
+
+    voyx::lifting::pow10(logs.data() + 1, envelope.data() + 1, size - 2);
+  }
 
   static void lowpass(std::span<T> cepstrum, const size_t quefrency)
   {
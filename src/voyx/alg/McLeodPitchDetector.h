@@ -0,0 +1,181 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/alg/FFT.h>
+#include <voyx/etc/Profiler.h>
+
+/**
+ * Time-domain pitch detection by the McLeod pitch method,
+ * which does not depend on a previously estimated cepstrum
+ * or log spectrum like the other pitch detectors do.
+ *
+ * The normalized square difference function of the frame
+ * is obtained from its autocorrelation via a zero padded FFT,
+ * i.e. in O(N log N) instead of O(N^2).
+ *
+ * Within the lag range of interest, the first key maximum
+ * exceeding the specified fraction of the highest key maximum
+ * is refined by parabolic interpolation. Its height is the clarity,
+ * which serves as a confidence between 0 and 1.
+ **/
+template<typename T>
+class McLeodPitchDetector
+{
+
+public:
+
+  McLeodPitchDetector(const std::pair<double, double> roi, const double samplerate, const size_t framesize, const double threshold = 0.9) :
+    roi(roi),
+    samplerate(samplerate),
+    framesize(framesize),
+    threshold(threshold),
+    fft(std::bit_ceil(framesize * 2)),
+    buffer(fft.framesize()),
+    spectrum(fft.dftsize()),
+    nsdf(framesize),
+    peaks(framesize)
+  {
+    voyxassert(framesize > 3);
+  }
+
+  double operator()(const voyx::vector<T> samples)
+  {
+    return detect(samples).first;
+  }
+
+  /**
+   * Returns the estimated frequency in hertz and its clarity,
+   * or both zero if there is no periodicity in the lag range.
+   **/
+  std::pair<double, double> detect(const voyx::vector<T> samples)
+  {
+    voyxprofile("McLeodPitchDetector::detect");
+
+    voyxassert(samples.size() == framesize);
+
+    const size_t nmin = size_t(1);
+    const size_t nmax = framesize - 2;
+
+    const size_t qmin = static_cast<size_t>(samplerate / std::max(roi.first, roi.second));
+    const size_t qmax = static_cast<size_t>(std::ceil(samplerate / std::min(roi.first, roi.second)));
+
+    const size_t imin = std::clamp(qmin, nmin, nmax);
+    const size_t imax = std::clamp(qmax, nmin, nmax);
+
+    std::copy(samples.begin(), samples.end(), buffer.begin());
+    std::fill(buffer.begin() + framesize, buffer.end(), T(0));
+
+    fft.fft(buffer, spectrum);
+
+    for (size_t i = 0; i < spectrum.size(); ++i)
+    {
+      spectrum[i] = std::norm(spectrum[i]);
+    }
+
+    // the linear autocorrelation up to the framesize,
+    // scaled by the framesize due to the forward FFT normalization
+    fft.ifft(spectrum, buffer);
+
+    const T scale = static_cast<T>(2 * fft.framesize());
+
+    T energy = 0;
+
+    for (size_t i = 0; i < framesize; ++i)
+    {
+      energy += samples[i] * samples[i];
+    }
+
+    energy *= 2;
+
+    for (size_t i = 0; i <= imax + 1; ++i)
+    {
+      nsdf[i] = (energy > 0) ? buffer[i] * scale / energy : 0;
+
+      energy -= samples[i] * samples[i] + samples[framesize - 1 - i] * samples[framesize - 1 - i];
+    }
+
+    // skip the lobe of the zero lag
+    size_t i = 1;
+
+    while (i <= imax && nsdf[i] > 0)
+    {
+      ++i;
+    }
+
+    // refine the sampled maximum by parabolic interpolation
+    const auto refine = [&](const size_t index) -> std::pair<T, T>
+    {
+      const T a = nsdf[index - 1];
+      const T b = nsdf[index];
+      const T c = nsdf[index + 1];
+
+      const T curvature = a - 2 * b + c;
+      const T shift = (curvature < 0) ? std::clamp<T>((a - c) / (2 * curvature), -1, +1) : 0;
+      const T peak = b - (a - c) * shift / 4;
+
+      return { shift, peak };
+    };
+
+    // collect the key maxima between the positive
+    // and negative going zero crossings
+    size_t count = 0;
+    T highest = 0;
+
+    while (i <= imax)
+    {
+      while (i <= imax && nsdf[i] <= 0)
+      {
+        ++i;
+      }
+
+      ptrdiff_t index = -1;
+      T value = 0;
+
+      while (i <= imax && nsdf[i] > 0)
+      {
+        if (i >= imin && nsdf[i] > value)
+        {
+          value = nsdf[i];
+          index = i;
+        }
+
+        ++i;
+      }
+
+      if (index > 0)
+      {
+        peaks[count++] = index;
+        highest = std::max(highest, refine(index).second);
+      }
+    }
+
+    // compare the interpolated heights, since the sampled ones
+    // underestimate short lags between two samples considerably
+    for (size_t j = 0; j < count; ++j)
+    {
+      const auto [shift, peak] = refine(peaks[j]);
+
+      if (peak >= threshold * highest)
+      {
+        return { samplerate / (peaks[j] + shift), std::clamp<T>(peak, 0, 1) };
+      }
+    }
+
+    return { 0, 0 };
+  }
+
+private:
+
+  const std::pair<double, double> roi;
+  const double samplerate;
+  const size_t framesize;
+  const double threshold;
+
+  FFT<T> fft;
+
+  std::vector<T> buffer;
+  std::vector<std::complex<T>> spectrum;
+  std::vector<T> nsdf;
+  std::vector<size_t> peaks;
+
+};
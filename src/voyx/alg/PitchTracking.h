@@ -0,0 +1,101 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/etc/Convert.h>
+
+/**
+ * Streaming pitch tracking with a voiced/unvoiced decision,
+ * as opposed to the NaivePitchTracking of each estimate on its own.
+ *
+ * A frame becomes voiced if its clarity reaches the upper threshold
+ * and remains voiced until the clarity drops below the lower threshold.
+ *
+ * While voiced, the median key of the last few estimates rejects
+ * sporadic octave errors, and the tracked key only moves to the nearest
+ * key of the median if it exceeds the rounding boundary by the specified
+ * hysteresis in semitones. So a pitch close to the boundary does not
+ * toggle between the adjacent keys.
+ *
+ * Each update costs O(length) with a fixed amount of memory.
+ **/
+class PitchTracking
+{
+
+public:
+
+  PitchTracking(const double concertpitch, const size_t length = 5, const double hysteresis = 0.25, const std::pair<double, double> clarity = { 0.6, 0.4 }) :
+    concertpitch(concertpitch),
+    hysteresis(hysteresis),
+    clarity(clarity),
+    history(std::max<size_t>(length, 1)),
+    buffer(history.size())
+  {
+  }
+
+  /**
+   * Returns the frequency of the tracked key in hertz,
+   * or zero if the specified estimate is considered unvoiced.
+   **/
+  double operator()(const double f0, const double clarity)
+  {
+    const double threshold = state ? this->clarity.second : this->clarity.first;
+
+    if (f0 <= 0 || clarity < threshold)
+    {
+      reset();
+      return 0;
+    }
+
+    history[cursor] = $$::midi::key(f0, concertpitch);
+    cursor = (cursor + 1) % history.size();
+    count = std::min(count + 1, history.size());
+
+    std::copy(history.begin(), history.begin() + count, buffer.begin());
+
+    const auto middle = buffer.begin() + count / 2;
+    std::nth_element(buffer.begin(), middle, buffer.begin() + count);
+
+    const double median = *middle;
+
+    if (!state || std::abs(median - key) > 0.5 + hysteresis)
+    {
+      key = std::round(median);
+    }
+
+    state = true;
+
+    return $$::midi::freq(key, concertpitch);
+  }
+
+  bool voiced() const
+  {
+    return state;
+  }
+
+  /**
+   * Forgets the estimation history, so that the next estimate
+   * has to reach the upper clarity threshold again.
+   **/
+  void reset()
+  {
+    state = false;
+    cursor = 0;
+    count = 0;
+  }
+
+private:
+
+  const double concertpitch;
+  const double hysteresis;
+  const std::pair<double, double> clarity;
+
+  std::vector<double> history;
+  std::vector<double> buffer;
+
+  size_t cursor = 0;
+  size_t count = 0;
+
+  bool state = false;
+  double key = 0;
+
+};
@@ -4,4 +4,9 @@
 
 #include <qdft/qdft.h>
 
+/**
+ * The external library is not instrumented itself, so the
+ * QdftPipeline reports each block as QDFT::qdft and QDFT::iqdft.
+ **/
+
 using namespace qdft;
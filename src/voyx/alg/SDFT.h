@@ -3,3 +3,8 @@
 #include <voyx/Header.h>
 
 #include <sdft/sdft.h>
+
+/**
+ * The external library is not instrumented itself, so the
+ * SdftPipeline reports each block as SDFT::sdft and SDFT::isdft.
+ **/
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Profiler.h>
 
 /**
  * Phase estimation from DFT magnitude according to [1].
@@ -27,6 +28,8 @@ public:
 
   void operator()(voyx::vector<std::complex<T>> dft)
   {
+    voyxprofile("SPSI::synthesize");
+
     const T pi = T(1) * std::acos(T(-1));
     const T inc = T(2) * pi * hopsize / framesize;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Profiler.h>
 
 template<typename T>
 class SRC
@@ -47,6 +48,8 @@ public:
 
   void operator()(const voyx::vector<T> src, voyx::vector<T> dst) const
   {
+    voyxprofile("SRC::resample");
+
     voyxassert(dst.size() == static_cast<size_t>(src.size() * quotient()));
 
     if (samplerates.second == samplerates.first)
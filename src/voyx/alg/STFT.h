@@ -3,6 +3,9 @@
 #include <voyx/Header.h>
 #include <voyx/alg/FFT.h>
 #include <voyx/etc/Convert.Window.h>
+#include <voyx/etc/Profiler.h>
+#include <voyx/etc/SlidingBuffer.h>
+#include <voyx/etc/Windowing.h>
 
 /**
  * Short-Time Fourier Transform implementation.
@@ -17,7 +20,9 @@ public:
     framesize(framesize),
     hopsize(hopsize),
     dftsize(dftsize),
-    fft(dftsize * 2 - /* nyquist */ 2)
+    fft(dftsize * 2 - /* nyquist */ 2),
+    input(fft.framesize() + framesize, framesize),
+    output(fft.framesize() + framesize, framesize)
   {
     voyxassert(fft.dftsize() == dftsize);
     voyxassert(fft.framesize() >= framesize);
@@ -44,8 +49,6 @@ public:
       data.hops.push_back(hop);
     }
 
-    data.input.resize(fft.framesize()  + framesize);
-    data.output.resize(fft.framesize() + framesize);
     data.frames.resize(fft.framesize() * data.hops.size());
   }
 
@@ -61,38 +64,39 @@ public:
 
   const voyx::vector<T> signal() const
   {
-    return voyx::vector(data.input.data() + framesize, fft.framesize());
+    return voyx::vector(input.window().data() + framesize, fft.framesize());
   }
 
   void stft(const voyx::vector<T> samples, voyx::matrix<std::complex<F>> dfts)
   {
+    voyxprofile("STFT::stft");
+
     voyxassert(samples.size() == framesize);
     voyxassert(dfts.size() == data.hops.size());
     voyxassert(dfts.stride() == fft.dftsize());
 
-    for (size_t i = 0; i < fft.framesize(); ++i)
-    {
-      const size_t j = i + framesize;
+    input.slide();
 
-      data.input[i] = data.input[j];
-    }
+    auto buffer = input.window();
 
     for (size_t i = 0; i < framesize; ++i)
     {
       const size_t j = i + fft.framesize();
 
-      data.input[j] = samples[i];
+      buffer[j] = samples[i];
     }
 
     voyx::matrix<F> frames(data.frames, fft.framesize());
 
-    reject(frames, data.input, data.hops, windows.analysis);
+    reject(frames, buffer, data.hops, windows.analysis);
 
     fft.fft(frames, dfts);
   }
 
   void istft(const voyx::matrix<std::complex<F>> dfts, voyx::vector<T> samples)
   {
+    voyxprofile("STFT::istft");
+
     voyxassert(dfts.size() == data.hops.size());
     voyxassert(dfts.stride() == fft.dftsize());
     voyxassert(samples.size() == framesize);
@@ -101,22 +105,18 @@ public:
 
     fft.ifft(dfts, frames);
 
-    inject(frames, data.output, data.hops, windows.synthesis);
+    auto buffer = output.window();
+
+    inject(frames, buffer, data.hops, windows.synthesis);
 
     for (size_t i = 0; i < framesize; ++i)
     {
       const size_t j = i + fft.framesize() - framesize;
 
-      samples[i] = data.output[j];
+      samples[i] = buffer[j];
     }
 
-    for (size_t i = 0; i < fft.framesize(); ++i)
-    {
-      const size_t j = i + framesize;
-
-      data.output[i] = data.output[j];
-      data.output[j] = 0;
-    }
+    output.slide();
   }
 
 private:
@@ -125,7 +125,7 @@ private:
   const size_t hopsize;
   const size_t dftsize;
 
-  const FFT<F> fft;
+  FFT<F> fft;
 
   struct
   {
@@ -134,10 +134,11 @@ private:
   }
   windows;
 
+  SlidingBuffer<T> input;
+  SlidingBuffer<T> output;
+
   struct
   {
-    std::vector<T> input;
-    std::vector<T> output;
     std::vector<F> frames;
     std::vector<size_t> hops;
   }
@@ -150,9 +151,16 @@ private:
       const auto hop = hops[i];
       auto frame = frames[i];
 
-      for (size_t j = 0; j < window.size(); ++j)
+      if constexpr (requires { voyx::windowing::multiply(input.data(), window.data(), frame.data(), window.size()); })
+      {
+        voyx::windowing::multiply(input.data() + hop, window.data(), frame.data(), window.size());
+      }
+      else
       {
-        frame[j] = input[hop + j] * window[j];
+        for (size_t j = 0; j < window.size(); ++j)
+        {
+          frame[j] = input[hop + j] * window[j];
+        }
       }
     }
   }
@@ -164,9 +172,16 @@ private:
       const auto hop = hops[i];
       const auto frame = frames[i];
 
-      for (size_t j = 0; j < window.size(); ++j)
+      if constexpr (requires { voyx::windowing::accumulate(frame.data(), window.data(), output.data(), window.size()); })
+      {
+        voyx::windowing::accumulate(frame.data(), window.data(), output.data() + hop, window.size());
+      }
+      else
       {
-        output[hop + j] += frame[j] * window[j];
+        for (size_t j = 0; j < window.size(); ++j)
+        {
+          output[hop + j] += frame[j] * window[j];
+        }
       }
     }
   }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Profiler.h>
 
 template<typename T>
 class SpectralPitchDetector
@@ -16,6 +17,8 @@ public:
 
   double operator()(const voyx::vector<T> spectrum) const
   {
+    voyxprofile("SpectralPitchDetector::detect");
+
     const size_t framesize = spectrum.size() * 2;
 
     const size_t nmin = size_t(0);
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Profiler.h>
+#include <voyx/etc/Vocoding.h>
 
 template<typename T>
 class Vocoder
@@ -49,6 +51,8 @@ public:
 
   void encode(voyx::matrix<std::complex<T>> dfts)
   {
+    voyxprofile("Vocoder::encode");
+
     for (auto dft : dfts)
     {
       encode(dft);
@@ -57,14 +61,111 @@ public:
 
   void decode(voyx::matrix<std::complex<T>> dfts)
   {
+    voyxprofile("Vocoder::decode");
+
     for (auto dft : dfts)
     {
       decode(dft);
     }
   }
 
+  /**
+   * Encodes the specified DFT frames into the separate magnitude
+   * and frequency rows of the specified spectrum without modifying
+   * the DFT frames themselves.
+   **/
+  void encode(const voyx::matrix<std::complex<T>> dfts, voyx::spectrum<T>& spectrum)
+  {
+    voyxprofile("Vocoder::encode");
+
+    spectrum.resize(dfts.size(), dfts.stride());
+
+    for (size_t i = 0; i < dfts.size(); ++i)
+    {
+      encode(dfts[i], spectrum.magnitude(i), spectrum.frequency(i));
+    }
+  }
+
+  /**
+   * Decodes the separate magnitude and frequency rows
+   * of the specified spectrum into the specified DFT frames.
+   **/
+  void decode(const voyx::spectrum<T>& spectrum, voyx::matrix<std::complex<T>> dfts)
+  {
+    voyxprofile("Vocoder::decode");
+
+    voyxassert(spectrum.size() == dfts.size());
+    voyxassert(spectrum.bins() == dfts.stride());
+
+    for (size_t i = 0; i < dfts.size(); ++i)
+    {
+      decode(spectrum.magnitude(i), spectrum.frequency(i), dfts[i]);
+    }
+  }
+
+  void encode(const voyx::vector<std::complex<T>> dft, voyx::vector<T> magnitude, voyx::vector<T> frequency)
+  {
+    voyxassert(magnitude.size() == dft.size());
+    voyxassert(frequency.size() == dft.size());
+
+    if constexpr (requires { voyx::vocoding::encode(dft.data(), magnitude.data(), frequency.data(), analysis.buffer.data(), dft.size(), freqinc, phaseinc); })
+    {
+      voyx::vocoding::encode(dft.data(), magnitude.data(), frequency.data(), analysis.buffer.data(), dft.size(), freqinc, phaseinc);
+      return;
+    }
+
+    T phase,
+      delta,
+      j;
+
+    for (size_t i = 0; i < dft.size(); ++i)
+    {
+      phase = atan2(dft[i]);
+
+      delta = phase - std::exchange(analysis.buffer[i], phase);
+
+      j = wrap(delta - i * phaseinc) / phaseinc;
+
+      magnitude[i] = std::abs(dft[i]);
+      frequency[i] = (i + j) * freqinc;
+    }
+  }
+
+  void decode(const voyx::vector<T> magnitude, const voyx::vector<T> frequency, voyx::vector<std::complex<T>> dft)
+  {
+    voyxassert(magnitude.size() == dft.size());
+    voyxassert(frequency.size() == dft.size());
+
+    if constexpr (requires { voyx::vocoding::decode(magnitude.data(), frequency.data(), dft.data(), synthesis.buffer.data(), synthesis.timeshift.data(), dft.size(), freqinc, phaseinc); })
+    {
+      voyx::vocoding::decode(magnitude.data(), frequency.data(), dft.data(), synthesis.buffer.data(), synthesis.timeshift.data(), dft.size(), freqinc, phaseinc);
+      return;
+    }
+
+    T phase,
+      delta,
+      j;
+
+    for (size_t i = 0; i < dft.size(); ++i)
+    {
+      j = (frequency[i] - i * freqinc) / freqinc;
+
+      delta = (i + j) * phaseinc;
+
+      phase = (synthesis.buffer[i] = wrap(synthesis.buffer[i] + delta)) - synthesis.timeshift[i];
+
+      dft[i] = std::polar<T>(magnitude[i], phase);
+    }
+  }
+
   void encode(voyx::vector<std::complex<T>> dft)
   {
+    if constexpr (requires { voyx::vocoding::encode(dft.data(), analysis.buffer.data(), dft.size(), freqinc, phaseinc); })
+    {
+      voyx::vocoding::encode(dft.data(), analysis.buffer.data(), dft.size(), freqinc, phaseinc);
+      return;
+    }
+
     T frequency,
       phase,
       delta,
@@ -86,6 +187,12 @@ public:
 
   void decode(voyx::vector<std::complex<T>> dft)
   {
+    if constexpr (requires { voyx::vocoding::decode(dft.data(), synthesis.buffer.data(), synthesis.timeshift.data(), dft.size(), freqinc, phaseinc); })
+    {
+      voyx::vocoding::decode(dft.data(), synthesis.buffer.data(), synthesis.timeshift.data(), dft.size(), freqinc, phaseinc);
+      return;
+    }
+
     T frequency,
       phase,
       delta,
@@ -99,7 +206,8 @@ public:
 
       delta = (i + j) * phaseinc;
 
-      phase = (synthesis.buffer[i] += delta) - synthesis.timeshift[i];
+      // keep the accumulated phase bounded to preserve its precision
+      phase = (synthesis.buffer[i] = wrap(synthesis.buffer[i] + delta)) - synthesis.timeshift[i];
 
       dft[i] = std::polar<T>(dft[i].real(), phase);
     }
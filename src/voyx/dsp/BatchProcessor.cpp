@@ -0,0 +1,287 @@
+#include <voyx/dsp/BatchProcessor.h>
+
+#include <voyx/Source.h>
+#include <voyx/dsp/PipelineFactory.h>
+#include <voyx/etc/WAV.h>
+#include <voyx/io/MemorySink.h>
+#include <voyx/io/MemorySource.h>
+
+BatchProcessor::BatchProcessor(const Job& defaults, const size_t workers) :
+  defaults(defaults),
+  workers(std::max<size_t>(workers, 1))
+{
+}
+
+std::vector<BatchProcessor::Job> BatchProcessor::load(const std::string& path, const std::string& output) const
+{
+  std::vector<Job> jobs;
+
+  if (std::filesystem::is_directory(path))
+  {
+    if (output.empty() || !std::filesystem::is_directory(output))
+    {
+      throw std::runtime_error(
+        $("Batch processing of \"{0}\" requires an existing output directory!", path));
+    }
+
+    std::vector<std::filesystem::path> files;
+
+    for (const auto& entry : std::filesystem::directory_iterator(path))
+    {
+      if (entry.is_regular_file() && $$::imatch(entry.path().string(), ".*.wav"))
+      {
+        files.push_back(entry.path());
+      }
+    }
+
+    std::sort(files.begin(), files.end());
+
+    for (const auto& file : files)
+    {
+      Job job = defaults;
+
+      job.input = file.string();
+      job.output = (std::filesystem::path(output) / file.filename()).string();
+
+      jobs.push_back(job);
+    }
+
+    return jobs;
+  }
+
+  std::ifstream file(path);
+
+  if (!file.is_open())
+  {
+    throw std::runtime_error(
+      $("Unable to open \"{0}\"!", path));
+  }
+
+  std::string line;
+  size_t number = 0;
+
+  while (std::getline(file, line))
+  {
+    ++number;
+
+    line = $$::trim(line);
+
+    if (line.empty() || line.front() == '#')
+    {
+      continue;
+    }
+
+    try
+    {
+      jobs.push_back(parse(line));
+    }
+    catch (const std::exception& exception)
+    {
+      throw std::runtime_error(
+        $("Invalid line {0} in \"{1}\": {2}", number, path, exception.what()));
+    }
+  }
+
+  return jobs;
+}
+
+size_t BatchProcessor::operator()(const std::vector<Job>& jobs) const
+{
+  typedef std::tuple<std::string, double, size_t, size_t, size_t> Key;
+
+  struct Slot
+  {
+    std::shared_ptr<MemorySource> source;
+    std::shared_ptr<MemorySink> sink;
+    std::shared_ptr<Pipeline<sample_t>> pipeline;
+    bool dirty;
+  };
+
+  const auto timestamp = std::chrono::steady_clock::now();
+
+  std::atomic<size_t> next = 0;
+  std::atomic<size_t> failures = 0;
+
+  double seconds = 0;
+  std::mutex mutex;
+
+  auto work = [&]()
+  {
+    std::map<Key, Slot> slots;
+
+    for (size_t i = next++; i < jobs.size(); i = next++)
+    {
+      const auto& job = jobs[i];
+
+      try
+      {
+        const auto jobtimestamp = std::chrono::steady_clock::now();
+
+        const Key key = { $$::lower(job.pipeline), job.samplerate, job.framesize, job.hopsize, job.dftsize };
+
+        auto& slot = slots[key];
+
+        if (slot.pipeline == nullptr)
+        {
+          slot.source = std::make_shared<MemorySource>(job.samplerate, job.framesize, 0);
+          slot.sink = std::make_shared<MemorySink>(job.samplerate, job.framesize, 0);
+
+          slot.pipeline = PipelineFactory::create(
+            job.pipeline, job.samplerate, job.framesize, job.hopsize, job.dftsize,
+            slot.source, slot.sink);
+
+          slot.pipeline->open();
+          slot.dirty = false;
+        }
+
+        std::vector<sample_t> data;
+
+        WAV::read(job.input, data, job.samplerate);
+
+        if (data.empty())
+        {
+          throw std::runtime_error(
+            $("The file is empty \"{0}\"!", job.input));
+        }
+
+        // flush the state of the previous job with silence,
+        // which is twice the STFT history including the analysis window
+        const size_t flush = slot.dirty ? (job.dftsize * 2 - 2 + job.framesize) * 2 : 0;
+
+        if (flush)
+        {
+          data.insert(data.begin(), flush, 0);
+        }
+
+        slot.source->assign(data);
+        slot.dirty = true;
+
+        slot.pipeline->render();
+
+        if (flush)
+        {
+          slot.sink->crop(flush, data.size() - flush);
+        }
+
+        WAV::write(job.output, slot.sink->samples(), job.samplerate);
+
+        const double duration = (data.size() - flush) / job.samplerate;
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - jobtimestamp).count();
+
+        {
+          std::lock_guard lock(mutex);
+          seconds += duration;
+        }
+
+        LOG(INFO) << $("Job {0}/{1} \"{2}\" rendered {3:.3f} s in {4:.3f} s, real-time factor {5:.3f}.",
+                       i + 1, jobs.size(), job.output, duration, elapsed, elapsed / duration);
+      }
+      catch (const std::exception& exception)
+      {
+        ++failures;
+
+        LOG(ERROR) << $("Job {0}/{1} \"{2}\" failed: {3}",
+                        i + 1, jobs.size(), job.input, exception.what());
+      }
+    }
+
+    for (auto& [key, slot] : slots)
+    {
+      if (slot.pipeline != nullptr)
+      {
+        slot.pipeline->close();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+
+  for (size_t i = 0; i < std::min(workers, jobs.size()); ++i)
+  {
+    threads.emplace_back(work);
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - timestamp).count();
+
+  LOG(INFO) << $("Processed {0} of {1} jobs with {2:.3f} s of audio in {3:.3f} s using {4} threads, throughput {5:.3f} s/s.",
+                 jobs.size() - failures, jobs.size(), seconds, elapsed, std::min(workers, jobs.size()),
+                 elapsed > 0 ? seconds / elapsed : 0);
+
+  return failures;
+}
+
+BatchProcessor::Job BatchProcessor::parse(const std::string& line) const
+{
+  std::istringstream stream(line);
+  std::vector<std::string> tokens;
+  std::string token;
+
+  while (stream >> token)
+  {
+    tokens.push_back(token);
+  }
+
+  if (tokens.size() < 2)
+  {
+    throw std::runtime_error(
+      "Expected at least the input and output file names!");
+  }
+
+  Job job = defaults;
+
+  job.input = tokens[0];
+  job.output = tokens[1];
+
+  size_t overlap = job.framesize / std::max<size_t>(job.hopsize, 1);
+
+  for (size_t i = 2; i < tokens.size(); ++i)
+  {
+    const auto pair = $$::split(tokens[i], '=');
+
+    if (pair.size() == 1 && i == 2)
+    {
+      job.pipeline = pair[0];
+    }
+    else if (pair.size() != 2)
+    {
+      throw std::runtime_error(
+        $("Unexpected token \"{0}\"!", tokens[i]));
+    }
+    else if (pair[0] == "sr")
+    {
+      job.samplerate = std::stod(pair[1]);
+    }
+    else if (pair[0] == "window")
+    {
+      job.framesize = std::stoul(pair[1]);
+    }
+    else if (pair[0] == "overlap")
+    {
+      overlap = std::stoul(pair[1]);
+    }
+    else if (pair[0] == "dftsize")
+    {
+      job.dftsize = std::stoul(pair[1]);
+    }
+    else
+    {
+      throw std::runtime_error(
+        $("Unknown parameter \"{0}\"!", pair[0]));
+    }
+  }
+
+  if (!job.samplerate || !job.framesize || !overlap || job.framesize % overlap)
+  {
+    throw std::runtime_error(
+      "Invalid sample rate, window or overlap!");
+  }
+
+  job.hopsize = job.framesize / overlap;
+
+  return job;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <voyx/Header.h>
+
+/**
+ * Processes a list of .wav files on a pool of worker threads.
+ *
+ * Each worker keeps its pipelines alive between jobs, so that
+ * jobs with the same pipeline name, sample rate, frame size,
+ * hop size and DFT size only pay the setup cost once.
+ *
+ * The manifest contains one job per line, e.g.
+ * "in.wav out.wav voicesynth sr=44100 window=1024 overlap=4 dftsize=1025".
+ * Omitted parameters are taken from the defaults, blank lines
+ * and lines starting with "#" are ignored.
+ **/
+class BatchProcessor
+{
+
+public:
+
+  struct Job
+  {
+    std::string input;
+    std::string output;
+    std::string pipeline;
+
+    double samplerate;
+    size_t framesize;
+    size_t hopsize;
+    size_t dftsize;
+  };
+
+  BatchProcessor(const Job& defaults, const size_t workers);
+
+  /**
+   * Reads the jobs from the specified manifest file, or enumerates
+   * all .wav files if the specified path is a directory,
+   * which are then written to the output directory.
+   **/
+  std::vector<Job> load(const std::string& path, const std::string& output) const;
+
+  /**
+   * Returns the number of failed jobs.
+   **/
+  size_t operator()(const std::vector<Job>& jobs) const;
+
+private:
+
+  const Job defaults;
+  const size_t workers;
+
+  Job parse(const std::string& line) const;
+
+};
@@ -10,6 +10,11 @@ public:
 
   BypassPipeline(std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink);
 
+  bool splittable() const override
+  {
+    return true;
+  }
+
 protected:
 
   void operator()(const size_t index, const voyx::vector<sample_t> input, voyx::vector<sample_t> output) override;
@@ -4,8 +4,9 @@
 
 InverseSynthPipeline::InverseSynthPipeline(const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize,
                                            std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink,
-                                           std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot) :
-  StftPipeline(samplerate, framesize, hopsize, dftsize, source, sink),
+                                           std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot,
+                                           const bool parallel) :
+  StftPipeline(samplerate, framesize, hopsize, dftsize, source, sink, parallel),
   vocoder(samplerate, framesize, hopsize, dftsize),
   midi(midi),
   plot(plot)
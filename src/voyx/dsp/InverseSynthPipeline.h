@@ -13,7 +13,8 @@ public:
 
   InverseSynthPipeline(const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize,
                        std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink,
-                       std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot);
+                       std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot,
+                       const bool parallel);
 
   void operator()(const size_t index,
                   const voyx::vector<sample_t> signal,
@@ -21,7 +22,7 @@ public:
 
 private:
 
-  Vocoder<double> vocoder;
+  Vocoder<phasor_t::value_type> vocoder;
 
   std::shared_ptr<MidiObserver> midi;
   std::shared_ptr<Plot> plot;
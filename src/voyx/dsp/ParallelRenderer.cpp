@@ -0,0 +1,136 @@
+#include <voyx/dsp/ParallelRenderer.h>
+
+#include <voyx/Source.h>
+#include <voyx/io/MemorySink.h>
+#include <voyx/io/MemorySource.h>
+
+ParallelRenderer::ParallelRenderer(const double samplerate, const size_t framesize, const size_t warmup, const size_t crossfade, const size_t jobs,
+                                   Factory factory) :
+  samplerate(samplerate),
+  framesize(framesize),
+  warmup(warmup),
+  crossfade(crossfade),
+  jobs(std::max<size_t>(jobs, 1)),
+  factory(factory)
+{
+}
+
+std::chrono::duration<double> ParallelRenderer::operator()(const std::vector<sample_t>& input, std::vector<sample_t>& output) const
+{
+  const auto timestamp = std::chrono::steady_clock::now();
+
+  output.assign(input.size(), 0);
+
+  if (input.empty())
+  {
+    return std::chrono::steady_clock::now() - timestamp;
+  }
+
+  const size_t preroll = warmup + crossfade;
+
+  // avoid segments being dominated by the warm-up section
+  size_t segments = std::clamp(input.size() / std::max<size_t>(preroll * 4, 1), size_t(1), jobs);
+
+  if (segments > 1 && !factory(std::make_shared<MemorySource>(samplerate, framesize, 0),
+                               std::make_shared<MemorySink>(samplerate, framesize, 0))->splittable())
+  {
+    LOG(WARNING) << "The selected pipeline accumulates state across frames, so it is rendered on a single thread!";
+
+    segments = 1;
+  }
+
+  const size_t segment = (input.size() + segments - 1) / segments;
+
+  struct Chunk
+  {
+    size_t begin;
+    size_t end;
+    std::vector<sample_t> samples;
+  };
+
+  std::vector<Chunk> chunks((input.size() + segment - 1) / segment);
+
+  for (size_t i = 0; i < chunks.size(); ++i)
+  {
+    const size_t begin = i * segment;
+
+    chunks[i].begin = (begin > preroll) ? begin - preroll : 0;
+    chunks[i].end = std::min(begin + segment, input.size());
+  }
+
+  std::atomic<size_t> next = 0;
+  std::exception_ptr error = nullptr;
+  std::mutex mutex;
+
+  auto work = [&]()
+  {
+    try
+    {
+      // a fresh pipeline instance per segment, so that the result
+      // does not depend on which segments a worker rendered before
+      for (size_t i = next++; i < chunks.size(); i = next++)
+      {
+        auto& chunk = chunks[i];
+
+        auto source = std::make_shared<MemorySource>(samplerate, framesize, 0);
+        auto sink = std::make_shared<MemorySink>(samplerate, framesize, 0);
+
+        auto pipeline = factory(source, sink);
+
+        source->assign(std::span(input).subspan(chunk.begin, chunk.end - chunk.begin));
+
+        pipeline->open();
+        pipeline->render();
+        pipeline->close();
+
+        chunk.samples = sink->samples();
+      }
+    }
+    catch (...)
+    {
+      std::lock_guard lock(mutex);
+      error = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+
+  for (size_t i = 0; i < std::min(jobs, chunks.size()); ++i)
+  {
+    threads.emplace_back(work);
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  if (error)
+  {
+    std::rethrow_exception(error);
+  }
+
+  for (size_t i = 0; i < chunks.size(); ++i)
+  {
+    const auto& chunk = chunks[i];
+
+    const size_t begin = i * segment;
+    const size_t fade = (i > 0) ? std::min(crossfade, begin - chunk.begin) : 0;
+
+    voyxassert(chunk.samples.size() == chunk.end - chunk.begin);
+
+    for (size_t j = begin - fade; j < begin; ++j)
+    {
+      const sample_t weight = sample_t(j + fade + 1 - begin) / (fade + 1);
+
+      output[j] = output[j] * (1 - weight) + chunk.samples[j - chunk.begin] * weight;
+    }
+
+    for (size_t j = begin; j < chunk.end; ++j)
+    {
+      output[j] = chunk.samples[j - chunk.begin];
+    }
+  }
+
+  return std::chrono::steady_clock::now() - timestamp;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/dsp/Pipeline.h>
+
+/**
+ * Renders a finite signal by splitting it into segments,
+ * which are processed by independent pipeline instances
+ * on a pool of worker threads.
+ *
+ * Each segment is rendered by a fresh pipeline instance and preceded
+ * by a warm-up section, which fills the STFT buffers and is discarded
+ * afterwards. Adjacent segments are joined by a short linear crossfade.
+ *
+ * Only splittable pipelines are divided, since no warm-up aligns
+ * the accumulated synthesis phases of independent vocoder instances.
+ * Any other pipeline is rendered as a single segment.
+ **/
+class ParallelRenderer
+{
+
+public:
+
+  typedef std::function<std::shared_ptr<Pipeline<sample_t>>(
+    std::shared_ptr<Source<sample_t>> source,
+    std::shared_ptr<Sink<sample_t>> sink)> Factory;
+
+  ParallelRenderer(const double samplerate, const size_t framesize, const size_t warmup, const size_t crossfade, const size_t jobs,
+                   Factory factory);
+
+  std::chrono::duration<double> operator()(const std::vector<sample_t>& input, std::vector<sample_t>& output) const;
+
+private:
+
+  const double samplerate;
+  const size_t framesize;
+  const size_t warmup;
+  const size_t crossfade;
+  const size_t jobs;
+
+  const Factory factory;
+
+};
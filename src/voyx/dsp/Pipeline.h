@@ -45,6 +45,8 @@ public:
 
     stop();
 
+    offline = false;
+
     source->start();
     sink->start();
 
@@ -64,6 +66,102 @@ public:
     sink->stop();
   }
 
+  /**
+   * Processes the whole finite source as fast as possible,
+   * flushes the pipeline latency and crops the sink output,
+   * so that it is sample-aligned with the source input.
+   * Returns the elapsed processing time.
+   **/
+  std::chrono::duration<double> render()
+  {
+    const size_t samples = source->length();
+    const size_t delay = latency();
+
+    if (!samples)
+    {
+      throw std::runtime_error(
+        "Unable to render an endless source!");
+    }
+
+    const size_t frames = (samples + delay + sink->framesize() - 1) / sink->framesize();
+
+    const auto elapsed = render(frames);
+
+    sink->crop(delay, samples);
+
+    return elapsed;
+  }
+
+  /**
+   * Processes the specified number of frames as fast as possible,
+   * e.g. of an endless source, without flushing the pipeline latency.
+   * Returns the elapsed processing time.
+   **/
+  std::chrono::duration<double> render(const size_t frames)
+  {
+    if (!frames)
+    {
+      throw std::runtime_error(
+        "Unable to render an endless number of frames!");
+    }
+
+    stop();
+
+    offline = true;
+
+    source->start();
+    sink->start();
+
+    const auto timestamp = std::chrono::steady_clock::now();
+
+    onstart(frames, std::chrono::duration<double>::zero());
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - timestamp;
+
+    stop();
+
+    return elapsed;
+  }
+
+  /**
+   * Returns the algorithmic latency in samples.
+   **/
+  virtual size_t latency() const
+  {
+    return 0;
+  }
+
+  /**
+   * Returns true if parts of the processing run on separate threads,
+   * i.e. if the pipeline supports and has enabled the parallel mode.
+   **/
+  virtual bool concurrent() const
+  {
+    return false;
+  }
+
+  /**
+   * Returns true if the output only depends on a bounded history
+   * of the input, so that independent instances agree after a warm-up.
+   * Pipelines which accumulate state, e.g. the synthesis phases
+   * of a vocoder, cannot be rendered in separate segments.
+   **/
+  virtual bool splittable() const
+  {
+    return false;
+  }
+
+  /**
+   * Returns true if the last run was started by render,
+   * so that pipelines can skip helper threads which only
+   * pay off in realtime and would make the output depend
+   * on the thread timing.
+   **/
+  bool rendering() const
+  {
+    return offline;
+  }
+
 public:
 
   const std::shared_ptr<Source<T>> source;
@@ -72,4 +170,8 @@ public:
   virtual void onstart(const size_t frames, const std::chrono::duration<double> timeout) = 0;
   virtual void onstop() = 0;
 
+private:
+
+  bool offline = false;
+
 };
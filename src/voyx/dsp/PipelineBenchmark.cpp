@@ -0,0 +1,89 @@
+#include <voyx/dsp/PipelineBenchmark.h>
+
+#include <voyx/Source.h>
+#include <voyx/dsp/PipelineFactory.h>
+#include <voyx/io/TimingSink.h>
+
+PipelineBenchmark::PipelineBenchmark(const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize, const size_t frames, const bool parallel,
+                                     Factory factory) :
+  samplerate(samplerate),
+  framesize(framesize),
+  hopsize(hopsize),
+  dftsize(dftsize),
+  frames(std::max<size_t>(frames, 1)),
+  parallel(parallel),
+  factory(factory)
+{
+}
+
+PipelineBenchmark::Result PipelineBenchmark::operator()(const std::string& pipeline) const
+{
+  auto source = factory();
+  auto sink = std::make_shared<TimingSink>(samplerate, framesize, 0);
+
+  auto pipe = PipelineFactory::create(pipeline, samplerate, framesize, hopsize, dftsize, source, sink, nullptr, nullptr, parallel);
+
+  pipe->open();
+
+  const std::chrono::duration<double> elapsed = pipe->render(frames);
+
+  pipe->close();
+
+  const auto& timer = sink->timer();
+
+  Result result;
+
+  result.pipeline = pipeline;
+  result.frames = frames;
+  result.seconds = elapsed.count();
+  result.fps = frames / elapsed.count();
+  result.rtf = elapsed.count() / (frames * framesize / samplerate);
+  result.p50 = timer.percentile(0.5);
+  result.p90 = timer.percentile(0.9);
+  result.p99 = timer.percentile(0.99);
+  result.p999 = timer.percentile(0.999);
+  result.max = timer.max();
+  result.misses = timer.miss();
+
+  return result;
+}
+
+std::string PipelineBenchmark::csv(const std::vector<Result>& results)
+{
+  std::ostringstream csv;
+
+  csv << "pipeline,frames,seconds,fps,rtf,p50_us,p90_us,p99_us,p999_us,max_us,misses" << std::endl;
+
+  for (const auto& result : results)
+  {
+    csv << $("{0},{1},{2:.6f},{3:.3f},{4:.6f},{5:.3f},{6:.3f},{7:.3f},{8:.3f},{9:.3f},{10}",
+             result.pipeline, result.frames, result.seconds, result.fps, result.rtf,
+             result.p50, result.p90, result.p99, result.p999, result.max, result.misses)
+        << std::endl;
+  }
+
+  return csv.str();
+}
+
+std::string PipelineBenchmark::json(const std::vector<Result>& results)
+{
+  std::ostringstream json;
+
+  json << "[" << std::endl;
+
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    const auto& result = results[i];
+
+    json << $("  {{\"pipeline\":\"{0}\",\"frames\":{1},\"seconds\":{2:.6f},\"fps\":{3:.3f},\"rtf\":{4:.6f},"
+              "\"p50_us\":{5:.3f},\"p90_us\":{6:.3f},\"p99_us\":{7:.3f},\"p999_us\":{8:.3f},\"max_us\":{9:.3f},\"misses\":{10}}}",
+              result.pipeline, result.frames, result.seconds, result.fps, result.rtf,
+              result.p50, result.p90, result.p99, result.p999, result.max, result.misses)
+         << (i + 1 < results.size() ? "," : "")
+         << std::endl;
+  }
+
+  json << "]" << std::endl;
+
+  return json.str();
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/io/Source.h>
+
+/**
+ * Runs pipelines unthrottled for a fixed number of frames
+ * and reports their throughput and per-frame latency.
+ **/
+class PipelineBenchmark
+{
+
+public:
+
+  struct Result
+  {
+    std::string pipeline;
+    size_t frames;
+    double seconds;
+    double fps;
+    double rtf;
+    double p50;
+    double p90;
+    double p99;
+    double p999;
+    double max;
+    uint64_t misses;
+  };
+
+  typedef std::function<std::shared_ptr<Source<sample_t>>()> Factory;
+
+  PipelineBenchmark(const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize, const size_t frames, const bool parallel,
+                    Factory factory);
+
+  Result operator()(const std::string& pipeline) const;
+
+  static std::string csv(const std::vector<Result>& results);
+  static std::string json(const std::vector<Result>& results);
+
+private:
+
+  const double samplerate;
+  const size_t framesize;
+  const size_t hopsize;
+  const size_t dftsize;
+  const size_t frames;
+  const bool parallel;
+
+  const Factory factory;
+
+};
@@ -0,0 +1,88 @@
+#include <voyx/dsp/PipelineFactory.h>
+
+#include <voyx/Source.h>
+
+#include <voyx/dsp/BypassPipeline.h>
+#include <voyx/dsp/InverseSynthPipeline.h>
+#include <voyx/dsp/QdftTestPipeline.h>
+#include <voyx/dsp/RobotPipeline.h>
+#include <voyx/dsp/SdftTestPipeline.h>
+#include <voyx/dsp/SlidingVoiceSynthPipeline.h>
+#include <voyx/dsp/StftPitchShiftPipeline.h>
+#include <voyx/dsp/StftTestPipeline.h>
+#include <voyx/dsp/VoiceSynthPipeline.h>
+
+const std::vector<std::string>& PipelineFactory::names()
+{
+  static const std::vector<std::string> names =
+  {
+    "bypass",
+    "inversesynth",
+    "qdfttest",
+    "robot",
+    "sdfttest",
+    "slidingvoicesynth",
+    "stftpitchshift",
+    "stfttest",
+    "voicesynth"
+  };
+
+  return names;
+}
+
+std::shared_ptr<Pipeline<sample_t>> PipelineFactory::create(const std::string& name,
+                                                            const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize,
+                                                            std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink,
+                                                            std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot,
+                                                            const bool parallel)
+{
+  const std::string key = $$::lower(name);
+
+  if (key == "bypass")
+  {
+    return std::make_shared<BypassPipeline>(source, sink);
+  }
+
+  if (key == "inversesynth")
+  {
+    return std::make_shared<InverseSynthPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, midi, plot, parallel);
+  }
+
+  if (key == "qdfttest")
+  {
+    return std::make_shared<QdftTestPipeline>(samplerate, framesize, source, sink, midi, plot);
+  }
+
+  if (key == "robot")
+  {
+    return std::make_shared<RobotPipeline>(samplerate, framesize, dftsize, source, sink, midi, plot);
+  }
+
+  if (key == "sdfttest")
+  {
+    return std::make_shared<SdftTestPipeline>(samplerate, framesize, dftsize, source, sink, midi, plot);
+  }
+
+  if (key == "slidingvoicesynth")
+  {
+    return std::make_shared<SlidingVoiceSynthPipeline>(samplerate, framesize, dftsize, source, sink, midi, plot, parallel);
+  }
+
+  if (key == "stftpitchshift")
+  {
+    return std::make_shared<StftPitchShiftPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, midi, plot);
+  }
+
+  if (key == "stfttest")
+  {
+    return std::make_shared<StftTestPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, midi, plot, parallel);
+  }
+
+  if (key == "voicesynth")
+  {
+    return std::make_shared<VoiceSynthPipeline>(samplerate, framesize, hopsize, dftsize, source, sink, midi, plot, parallel);
+  }
+
+  throw std::runtime_error(
+    $("Unknown pipeline \"{0}\"!", name));
+}
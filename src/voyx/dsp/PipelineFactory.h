@@ -0,0 +1,21 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/dsp/Pipeline.h>
+#include <voyx/io/MidiObserver.h>
+#include <voyx/ui/Plot.h>
+
+/**
+ * Creates pipeline instances by their lowercase class name
+ * without the "Pipeline" suffix, e.g. "voicesynth".
+ **/
+struct PipelineFactory
+{
+  static const std::vector<std::string>& names();
+
+  static std::shared_ptr<Pipeline<sample_t>> create(const std::string& name,
+                                                    const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize,
+                                                    std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink,
+                                                    std::shared_ptr<MidiObserver> midi = nullptr, std::shared_ptr<Plot> plot = nullptr,
+                                                    const bool parallel = false);
+};
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/alg/DecimatedPitchDetector.h>
+#include <voyx/alg/PitchTracking.h>
+#include <voyx/etc/SlidingBuffer.h>
+#include <voyx/etc/Tracer.h>
+
+#include <readerwriterqueue.h>
+
+/**
+ * Side-chain pitch analysis, which optionally runs on a separate thread
+ * to keep the pitch detection off the realtime critical path.
+ *
+ * The detector sees a history window of the latest frames,
+ * which spans at least two periods of the lowest frequency
+ * of interest, so small frame sizes do not limit the pitch range.
+ *
+ * The realtime thread copies the history window into preallocated slots,
+ * which are passed to the worker thread by lock-free queues. If all slots
+ * are in use, the frame is dropped instead of blocking, and the worker
+ * always skips to the most recent pending frame anyway.
+ *
+ * The latest tracked pitch and its clarity are published as a single
+ * lock-free atomic snapshot, so reading it is wait-free. The frequency
+ * is zero while the tracker considers the input unvoiced. In the parallel
+ * mode the snapshot lags the input by about the detection time.
+ * Otherwise each frame is analyzed immediately on push.
+ **/
+template<typename T>
+class PitchAnalyzer
+{
+
+public:
+
+  struct Snapshot
+  {
+    float frequency;
+    float clarity;
+  };
+
+  static_assert(std::atomic<Snapshot>::is_always_lock_free);
+
+  PitchAnalyzer(const std::pair<double, double> roi, const double samplerate, const size_t framesize, const double concertpitch, const size_t slots = 4) :
+    framesize(framesize),
+    windowsize(std::max(framesize, DecimatedPitchDetector<T>::minimum(roi, samplerate))),
+    detector(roi, samplerate, windowsize),
+    tracker(concertpitch),
+    history(windowsize, framesize),
+    slots(slots),
+    idle(slots),
+    pending(slots)
+  {
+    for (auto& slot : this->slots)
+    {
+      slot.resize(windowsize);
+      idle.enqueue(&slot);
+    }
+  }
+
+  ~PitchAnalyzer()
+  {
+    stop();
+  }
+
+  void start()
+  {
+    if (thread != nullptr)
+    {
+      return;
+    }
+
+    doloop = true;
+
+    thread = std::make_shared<std::thread>(
+      [this](){ loop(); });
+  }
+
+  void stop()
+  {
+    doloop = false;
+
+    if (thread != nullptr)
+    {
+      if (thread->joinable())
+      {
+        thread->join();
+      }
+
+      thread = nullptr;
+    }
+
+    std::vector<T>* slot;
+
+    while (pending.try_dequeue(slot))
+    {
+      idle.enqueue(slot);
+    }
+  }
+
+  /**
+   * Returns the size of the history window in samples.
+   **/
+  size_t window() const
+  {
+    return windowsize;
+  }
+
+  /**
+   * Appends the specified frame to the history and analyzes the window,
+   * either immediately or by passing a copy to the worker thread.
+   * Returns false if the window has been dropped, because the worker
+   * thread is still busy with all slots.
+   **/
+  bool push(const voyx::vector<T> samples)
+  {
+    if (thread == nullptr)
+    {
+      const auto [frequency, clarity] = detect(samples);
+
+      if (full())
+      {
+        publish(frequency, clarity);
+      }
+
+      return true;
+    }
+
+    append(samples);
+
+    if (!full())
+    {
+      return true;
+    }
+
+    std::vector<T>* slot;
+
+    if (!idle.try_dequeue(slot))
+    {
+      ++drops;
+      return false;
+    }
+
+    const auto window = history.window();
+
+    std::copy(window.data(), window.data() + windowsize, slot->begin());
+
+    pending.enqueue(slot);
+
+    return true;
+  }
+
+  /**
+   * Appends the specified frame to the history and returns the untracked
+   * frequency estimate of the window and its clarity. Only for the inline
+   * mode, since the detector is not shared with the worker thread.
+   **/
+  std::pair<double, double> detect(const voyx::vector<T> samples)
+  {
+    voyxassert(thread == nullptr);
+
+    append(samples);
+
+    return detector.detect(history.window());
+  }
+
+  /**
+   * Returns true once the history window is filled and thus covers
+   * the whole frequency range of interest. Until then the snapshot
+   * is not updated, so its zero frequency does not mean unvoiced.
+   **/
+  bool full() const
+  {
+    return filled >= windowsize;
+  }
+
+  Snapshot snapshot() const
+  {
+    return latest.load(std::memory_order_acquire);
+  }
+
+  size_t dropped() const
+  {
+    return drops;
+  }
+
+private:
+
+  const size_t framesize;
+  const size_t windowsize;
+
+  DecimatedPitchDetector<T> detector;
+  PitchTracking tracker;
+
+  SlidingBuffer<T> history;
+  size_t filled = 0;
+
+  std::vector<std::vector<T>> slots;
+
+  moodycamel::BlockingReaderWriterQueue<std::vector<T>*> idle;
+  moodycamel::BlockingReaderWriterQueue<std::vector<T>*> pending;
+
+  std::atomic<Snapshot> latest = Snapshot { 0, 0 };
+  std::atomic<size_t> drops = 0;
+
+  std::shared_ptr<std::thread> thread;
+  std::atomic<bool> doloop = false;
+
+  void append(const voyx::vector<T> samples)
+  {
+    voyxassert(samples.size() == framesize);
+
+    history.slide();
+
+    filled = std::min(filled + framesize, windowsize);
+
+    auto window = history.window();
+
+    std::copy(samples.begin(), samples.end(), window.data() + (windowsize - framesize));
+  }
+
+  void publish(const double frequency, const double clarity)
+  {
+    const Snapshot snapshot
+    {
+      static_cast<float>(tracker(frequency, clarity)),
+      static_cast<float>(clarity)
+    };
+
+    latest.store(snapshot, std::memory_order_release);
+  }
+
+  void loop()
+  {
+    voyx::tracer::name("PitchAnalyzer::loop");
+
+    const auto timeout = std::chrono::milliseconds(10);
+
+    std::vector<T>* slot;
+    std::vector<T>* next;
+
+    while (doloop)
+    {
+      if (!pending.wait_dequeue_timed(slot, timeout))
+      {
+        continue;
+      }
+
+      // skip outdated windows
+      while (pending.try_dequeue(next))
+      {
+        idle.enqueue(slot);
+        slot = next;
+      }
+
+      {
+        voyxtrace("PitchAnalyzer::detect");
+
+        const auto [frequency, clarity] = detector.detect(*slot);
+
+        publish(frequency, clarity);
+      }
+
+      idle.enqueue(slot);
+    }
+  }
+
+};
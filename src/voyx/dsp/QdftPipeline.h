@@ -3,6 +3,7 @@
 #include <voyx/Header.h>
 #include <voyx/alg/QDFT.h>
 #include <voyx/dsp/SyncPipeline.h>
+#include <voyx/etc/Profiler.h>
 
 template<typename T = sample_t>
 class QdftPipeline : public SyncPipeline<sample_t>
@@ -33,9 +34,20 @@ protected:
   {
     voyx::matrix<phasor_t> dfts(data.dfts, qdft.size());
 
-    qdft.qdft(dfts.size(), input.data(), dfts.data());
-    (*this)(index, dfts);
-    qdft.iqdft(dfts.size(), dfts.data(), output.data());
+    {
+      voyxprofile("QDFT::qdft");
+      qdft.qdft(dfts.size(), input.data(), dfts.data());
+    }
+
+    {
+      voyxprofile("QdftPipeline::process");
+      (*this)(index, dfts);
+    }
+
+    {
+      voyxprofile("QDFT::iqdft");
+      qdft.iqdft(dfts.size(), dfts.data(), output.data());
+    }
   }
 
   virtual void operator()(const size_t index, voyx::matrix<phasor_t> dfts) = 0;
@@ -3,6 +3,7 @@
 #include <voyx/Header.h>
 #include <voyx/alg/SDFT.h>
 #include <voyx/dsp/SyncPipeline.h>
+#include <voyx/etc/Profiler.h>
 
 template<typename T = sample_t>
 class SdftPipeline : public SyncPipeline<sample_t>
@@ -30,9 +31,20 @@ protected:
   {
     voyx::matrix<phasor_t> dfts(data.dfts, dftsize);
 
-    sdft.sdft(dfts.size(), input.data(), dfts.data());
-    (*this)(index, dfts);
-    sdft.isdft(dfts.size(), dfts.data(), output.data());
+    {
+      voyxprofile("SDFT::sdft");
+      sdft.sdft(dfts.size(), input.data(), dfts.data());
+    }
+
+    {
+      voyxprofile("SdftPipeline::process");
+      (*this)(index, dfts);
+    }
+
+    {
+      voyxprofile("SDFT::isdft");
+      sdft.isdft(dfts.size(), dfts.data(), output.data());
+    }
   }
 
   virtual void operator()(const size_t index, voyx::matrix<phasor_t> dfts) = 0;
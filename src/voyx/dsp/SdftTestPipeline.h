@@ -20,7 +20,7 @@ public:
 
 private:
 
-  Vocoder<double> vocoder;
+  Vocoder<phasor_t::value_type> vocoder;
 
   std::shared_ptr<MidiObserver> midi;
   std::shared_ptr<Plot> plot;
@@ -4,15 +4,24 @@
 
 SlidingVoiceSynthPipeline::SlidingVoiceSynthPipeline(const double samplerate, const size_t framesize, const size_t dftsize,
                                                      std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink,
-                                                     std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot) :
+                                                     std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot,
+                                                     const bool parallel) :
   SdftPipeline(samplerate, framesize, dftsize, source, sink),
   midi(midi),
   plot(plot),
+  parallel(parallel),
   vocoder(samplerate, framesize, 1, dftsize),
   lifter(1e-3, samplerate, dftsize * 2),
-  pda({ 50, 1000 }, samplerate),
-  ptr(442)
+  cache(0.05, std::max<size_t>(static_cast<size_t>(50e-3 * samplerate / framesize), 1)),
+  pitch({ 50, 1000 }, samplerate, framesize, 442)
 {
+  // one spectrum per sample, allocated once up front
+  spectra.resize(framesize, dftsize);
+  envelope.resize(dftsize);
+  spectrum.resize(dftsize);
+  abs0.resize(dftsize);
+  abs1.resize(dftsize);
+
   if (plot != nullptr)
   {
     plot->xmap(samplerate / 2);
@@ -21,6 +30,52 @@ SlidingVoiceSynthPipeline::SlidingVoiceSynthPipeline(const double samplerate, co
   }
 }
 
+bool SlidingVoiceSynthPipeline::concurrent() const
+{
+  return parallel;
+}
+
+void SlidingVoiceSynthPipeline::onstart(const size_t frames, const std::chrono::duration<double> timeout)
+{
+  // offline renders analyze inline and stay deterministic
+  if (parallel && !rendering())
+  {
+    pitch.start();
+  }
+
+  SdftPipeline::onstart(frames, timeout);
+}
+
+void SlidingVoiceSynthPipeline::onstop()
+{
+  SdftPipeline::onstop();
+
+  pitch.stop();
+}
+
+void SlidingVoiceSynthPipeline::operator()(const size_t index,
+                                           const voyx::vector<sample_t> input,
+                                           voyx::vector<sample_t> output)
+{
+  // detect the pitch in the time domain, so that neither
+  // the log spectrum nor the cepstrum is required for it,
+  // and keep the last pitch in unvoiced or silent frames
+  pitch.push(input);
+
+  const auto frequency = pitch.snapshot().frequency;
+
+  // only trust an unvoiced decision if the analysis
+  // already covers the whole frequency range
+  unvoiced = pitch.full() && frequency <= 0;
+
+  if (frequency > 0)
+  {
+    f0 = frequency;
+  }
+
+  SdftPipeline::operator()(index, input, output);
+}
+
 void SlidingVoiceSynthPipeline::operator()(const size_t index,
                                            voyx::matrix<phasor_t> dfts)
 {
@@ -42,47 +97,67 @@ void SlidingVoiceSynthPipeline::operator()(const size_t index,
 
   this->frequencies = frequencies;
 
-  vocoder.encode(dfts);
+  // nothing to shift from until the first voiced frame
+  if (f0 <= 0)
+  {
+    frequencies.clear();
+  }
 
-  std::vector<double> envelope(dfts.stride());
-  std::vector<double> spectrum(dfts.stride());
-  std::vector<double> cepstrum(dfts.stride() * 2);
+  // keep encoding unvoiced frames as well, otherwise the analysis
+  // phases would be outdated and the instantaneous frequencies
+  // of the next voiced frame wrong
+  vocoder.encode(dfts, spectra);
 
-  std::vector<double> abs0(dfts.stride());
-  std::vector<double> abs1(dfts.stride());
+  // there is nothing to shift from in unvoiced frames,
+  // so skip the rest of the resynthesis and restart with
+  // a fresh envelope at the next voiced frame
+  if (unvoiced)
+  {
+    dfts = phasor_t(0);
+    cache.reset();
+    return;
+  }
 
-  lifter.lowpass<$$::real>(dfts.front(), envelope, spectrum, cepstrum);
+  if (cache.update(spectra.magnitude(0)))
+  {
+    lifter.lowpass(spectra.magnitude(0), envelope);
+  }
 
-  auto f0 = ptr(pda(spectrum));
+  if (plot != nullptr && spectra.bins() > 2)
+  {
+    voyx::lifting::log10(spectra.magnitude(0).data() + 1, spectrum.data() + 1, spectra.bins() - 2);
+  }
 
-  for (auto dft : dfts)
+  for (size_t k = 0; k < spectra.size(); ++k)
   {
-    lifter.divide<$$::real>(dft, envelope);
+    auto magnitude = spectra.magnitude(k);
+
+    lifter.divide(magnitude, envelope);
 
-    for (size_t i = 0; i < dft.size(); ++i)
+    for (size_t i = 0; i < magnitude.size(); ++i)
     {
-      abs0[i] = dft[i].real();
+      abs0[i] = magnitude[i];
 
-      dft[i].real(0);
+      magnitude[i] = 0;
     }
 
     for (const auto f1 : frequencies)
     {
       const auto ratio = f1 / f0;
-      const auto invratio = 1 / ratio;
+      const auto invratio = static_cast<phasor_t::value_type>(1 / ratio);
 
       $$::interp(abs0, abs1, ratio);
 
-      for (size_t i = 0; i < dft.size(); ++i)
+      for (size_t i = 0; i < magnitude.size(); ++i)
       {
-        dft[i].real(std::max(abs1[i] * invratio, dft[i].real()));
+        magnitude[i] = std::max(abs1[i] * invratio, magnitude[i]);
       }
     }
 
-    lifter.multiply<$$::real>(dft, envelope);
+    lifter.multiply(magnitude, envelope);
   }
 
-  vocoder.decode(dfts);
+  vocoder.decode(spectra, dfts);
 
   if (plot != nullptr)
   {
@@ -1,10 +1,10 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/alg/EnvelopeCache.h>
 #include <voyx/alg/Lifter.h>
-#include <voyx/alg/NaivePitchTracking.h>
-#include <voyx/alg/SpectralPitchDetector.h>
 #include <voyx/alg/Vocoder.h>
+#include <voyx/dsp/PitchAnalyzer.h>
 #include <voyx/dsp/SdftPipeline.h>
 #include <voyx/io/MidiObserver.h>
 #include <voyx/ui/Plot.h>
@@ -16,21 +16,44 @@ public:
 
   SlidingVoiceSynthPipeline(const double samplerate, const size_t framesize, const size_t dftsize,
                             std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink,
-                            std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot);
+                            std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot,
+                            const bool parallel = false);
+
+  bool concurrent() const override;
 
   void operator()(const size_t index,
                   voyx::matrix<phasor_t> dfts) override;
 
+protected:
+
+  void onstart(const size_t frames, const std::chrono::duration<double> timeout) override;
+  void onstop() override;
+
+  void operator()(const size_t index,
+                  const voyx::vector<sample_t> input,
+                  voyx::vector<sample_t> output) override;
+
 private:
 
   std::shared_ptr<MidiObserver> midi;
   std::shared_ptr<Plot> plot;
 
-  Vocoder<double> vocoder;
-  Lifter<double> lifter;
+  const bool parallel;
+
+  Vocoder<phasor_t::value_type> vocoder;
+  Lifter<phasor_t::value_type> lifter;
+  EnvelopeCache<phasor_t::value_type> cache;
+
+  voyx::spectrum<phasor_t::value_type> spectra;
+  std::vector<phasor_t::value_type> envelope;
+  std::vector<phasor_t::value_type> spectrum;
+  std::vector<phasor_t::value_type> abs0;
+  std::vector<phasor_t::value_type> abs1;
+
+  PitchAnalyzer<sample_t> pitch;
 
-  SpectralPitchDetector<double> pda;
-  NaivePitchTracking ptr;
+  double f0 = 0;
+  bool unvoiced = false;
 
   std::set<double> frequencies;
 
@@ -3,22 +3,58 @@
 #include <voyx/Header.h>
 #include <voyx/alg/STFT.h>
 #include <voyx/dsp/SyncPipeline.h>
+#include <voyx/etc/Allocation.h>
+#include <voyx/etc/Tracer.h>
 
+#include <readerwriterqueue.h>
+
+/**
+ * In the parallel mode the STFT analysis, the spectral processing
+ * and the STFT synthesis are running as separate stages on
+ * separate threads, which are connected by preallocated lock-free
+ * queues. Each stage boundary delays the output by one frame,
+ * so the parallel mode adds two frames of latency in total.
+ *
+ * Since the analysis stage waits for free frames, the parallel mode
+ * must not run inside an audio callback, e.g. of a duplex stream.
+ **/
 template<typename T = sample_t>
 class StftPipeline : public SyncPipeline<sample_t>
 {
 
 public:
 
-  StftPipeline(const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize, std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink) :
+  StftPipeline(const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize, std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink, const bool parallel = false) :
     SyncPipeline<sample_t>(source, sink),
     samplerate(samplerate),
     framesize(framesize),
     hopsize(hopsize),
     dftsize(dftsize),
-    stft(framesize, hopsize, dftsize)
+    parallel(parallel),
+    analysis(framesize, hopsize, dftsize),
+    synthesis(framesize, hopsize, dftsize),
+    stages(parallel ? stagedepth + 1 : 0)
+  {
+    data.dfts.resize(analysis.hops().size() * analysis.size());
+
+    for (auto& frame : stages.frames)
+    {
+      frame.signal.resize(analysis.signal().size());
+      frame.dfts.resize(data.dfts.size());
+      frame.output.resize(framesize);
+
+      stages.idle.enqueue(&frame);
+    }
+  }
+
+  size_t latency() const override
+  {
+    return framesize * (parallel ? stagedepth + 1 : 1);
+  }
+
+  bool concurrent() const override
   {
-    data.dfts.resize(stft.hops().size() * stft.size());
+    return parallel;
   }
 
 protected:
@@ -27,21 +63,73 @@ protected:
   const size_t framesize;
   const size_t hopsize;
   const size_t dftsize;
+  const bool parallel;
+
+  void onstart(const size_t frames, const std::chrono::duration<double> timeout) override
+  {
+    if (parallel)
+    {
+      stages.doloop = true;
+
+      stages.threads.spectral = std::make_shared<std::thread>(
+        [this](){ spectral(); });
+
+      stages.threads.synthesis = std::make_shared<std::thread>(
+        [this](){ synthesize(); });
+    }
+
+    SyncPipeline<sample_t>::onstart(frames, timeout);
+  }
+
+  void onstop() override
+  {
+    SyncPipeline<sample_t>::onstop();
+
+    if (parallel)
+    {
+      stages.doloop = false;
+
+      for (auto thread : { stages.threads.spectral, stages.threads.synthesis })
+      {
+        if (thread != nullptr && thread->joinable())
+        {
+          thread->join();
+        }
+      }
+
+      stages.threads.spectral = nullptr;
+      stages.threads.synthesis = nullptr;
+
+      stages.recycle();
+    }
+  }
 
   void operator()(const size_t index, const voyx::vector<sample_t> input, voyx::vector<sample_t> output) override
   {
-    voyx::matrix<phasor_t> dfts(data.dfts, stft.size());
+    if (parallel)
+    {
+      analyze(index, input, output);
+      return;
+    }
+
+    voyx::matrix<phasor_t> dfts(data.dfts, analysis.size());
 
-    stft.stft(input, dfts);
-    (*this)(index, stft.signal(), dfts);
-    stft.istft(dfts, output);
+    analysis.stft(input, dfts);
+    process(index, analysis.signal(), dfts);
+    synthesis.istft(dfts, output);
   }
 
   virtual void operator()(const size_t index, const voyx::vector<sample_t> signal, voyx::matrix<phasor_t> dfts) = 0;
 
 private:
 
-  STFT<sample_t, phasor_t::value_type> stft;
+  /**
+   * Number of stages following the STFT analysis.
+   **/
+  static const size_t stagedepth = 2;
+
+  STFT<sample_t, phasor_t::value_type> analysis;
+  STFT<sample_t, phasor_t::value_type> synthesis;
 
   struct
   {
@@ -49,4 +137,158 @@ private:
   }
   data;
 
+  struct Frame
+  {
+    size_t index;
+    std::vector<sample_t> signal;
+    std::vector<phasor_t> dfts;
+    std::vector<sample_t> output;
+  };
+
+  struct Stages
+  {
+    Stages(const size_t size) :
+      frames(size),
+      idle(size),
+      analyzed(size),
+      processed(size),
+      synthesized(size)
+    {
+    }
+
+    std::vector<Frame> frames;
+
+    moodycamel::BlockingReaderWriterQueue<Frame*> idle;
+    moodycamel::BlockingReaderWriterQueue<Frame*> analyzed;
+    moodycamel::BlockingReaderWriterQueue<Frame*> processed;
+    moodycamel::BlockingReaderWriterQueue<Frame*> synthesized;
+
+    size_t pending = 0;
+
+    std::atomic<bool> doloop = false;
+
+    struct
+    {
+      std::shared_ptr<std::thread> spectral;
+      std::shared_ptr<std::thread> synthesis;
+    }
+    threads;
+
+    void recycle()
+    {
+      Frame* frame;
+
+      while (analyzed.try_dequeue(frame))
+      {
+        idle.enqueue(frame);
+      }
+
+      while (processed.try_dequeue(frame))
+      {
+        idle.enqueue(frame);
+      }
+
+      while (synthesized.try_dequeue(frame))
+      {
+        idle.enqueue(frame);
+      }
+
+      pending = 0;
+    }
+  }
+  stages;
+
+  void process(const size_t index, const voyx::vector<sample_t> signal, voyx::matrix<phasor_t> dfts)
+  {
+    voyxprofile("StftPipeline::process");
+    voyxtrace("StftPipeline::process");
+    voyxrealtime("StftPipeline::process");
+
+    (*this)(index, signal, dfts);
+  }
+
+  void analyze(const size_t index, const voyx::vector<sample_t> input, voyx::vector<sample_t> output)
+  {
+    Frame* frame;
+
+    if (!stages.idle.try_dequeue(frame))
+    {
+      throw std::runtime_error(
+        "Exhausted STFT pipeline stages!");
+    }
+
+    frame->index = index;
+
+    analysis.stft(input, voyx::matrix<phasor_t>(frame->dfts, analysis.size()));
+
+    const auto signal = analysis.signal();
+
+    std::copy(signal.data(), signal.data() + signal.size(), frame->signal.begin());
+
+    stages.analyzed.enqueue(frame);
+
+    if (++stages.pending <= stagedepth)
+    {
+      output = sample_t(0);
+      return;
+    }
+
+    while (!stages.synthesized.wait_dequeue_timed(frame, this->source->timeout()))
+    {
+      if (!stages.doloop)
+      {
+        output = sample_t(0);
+        return;
+      }
+    }
+
+    output = voyx::vector<sample_t>(frame->output);
+
+    stages.idle.enqueue(frame);
+
+    --stages.pending;
+  }
+
+  void spectral()
+  {
+    voyx::tracer::name("StftPipeline::spectral");
+
+    Frame* frame;
+
+    while (stages.doloop)
+    {
+      if (!stages.analyzed.wait_dequeue_timed(frame, this->source->timeout()))
+      {
+        continue;
+      }
+
+      process(frame->index, frame->signal, voyx::matrix<phasor_t>(frame->dfts, analysis.size()));
+
+      stages.processed.enqueue(frame);
+    }
+  }
+
+  void synthesize()
+  {
+    voyx::tracer::name("StftPipeline::synthesize");
+
+    Frame* frame;
+
+    while (stages.doloop)
+    {
+      if (!stages.processed.wait_dequeue_timed(frame, this->source->timeout()))
+      {
+        continue;
+      }
+
+      {
+        voyxtrace("StftPipeline::synthesize");
+        voyxrealtime("StftPipeline::synthesize");
+        synthesis.istft(voyx::matrix<phasor_t>(frame->dfts, synthesis.size()), frame->output);
+      }
+
+      stages.synthesized.enqueue(frame);
+    }
+  }
+
 };
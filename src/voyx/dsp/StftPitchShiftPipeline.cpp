@@ -25,8 +25,8 @@ StftPitchShiftPipeline::StftPitchShiftPipeline(const double samplerate, const si
     std::get<0>(this->framesize) +
     std::get<1>(this->framesize);
 
-  buffer.input.resize(total_buffer_size);
-  buffer.output.resize(total_buffer_size);
+  buffer.input = std::make_shared<SlidingBuffer<double>>(total_buffer_size, std::get<1>(this->framesize));
+  buffer.output = std::make_shared<SlidingBuffer<double>>(total_buffer_size, std::get<1>(this->framesize));
 
   stft = std::make_shared<STFT<double>>(this->framesize, hopsize);
   core = std::make_shared<StftPitchShiftCore<double>>(this->framesize, hopsize, samplerate);
@@ -37,6 +37,11 @@ StftPitchShiftPipeline::StftPitchShiftPipeline(const double samplerate, const si
   core->normalization(false);
 }
 
+size_t StftPitchShiftPipeline::latency() const
+{
+  return std::get<1>(framesize);
+}
+
 void StftPitchShiftPipeline::operator()(const size_t index, const voyx::vector<sample_t> input, voyx::vector<sample_t> output)
 {
   auto show = [&](std::span<std::complex<double>> dft)
@@ -57,19 +62,19 @@ void StftPitchShiftPipeline::operator()(const size_t index, const voyx::vector<s
   const auto analysis_window_size = std::get<0>(framesize);
   const auto synthesis_window_size = std::get<1>(framesize);
 
-  std::copy(
-    buffer.input.begin() + synthesis_window_size,
-    buffer.input.end(),
-    buffer.input.begin());
+  buffer.input->slide();
+
+  auto x = buffer.input->window();
+  auto y = buffer.output->window();
 
   std::copy(
     input.begin(),
     input.end(),
-    buffer.input.begin() + analysis_window_size);
+    x.data() + analysis_window_size);
 
   size_t hop = 0;
 
-  (*stft)(buffer.input, buffer.output, [&](std::span<std::complex<double>> dft)
+  (*stft)(std::span<const double>(x.data(), x.size()), std::span<double>(y.data(), y.size()), [&](std::span<std::complex<double>> dft)
   {
     if (!hop)
     {
@@ -82,17 +87,9 @@ void StftPitchShiftPipeline::operator()(const size_t index, const voyx::vector<s
   });
 
   std::copy(
-    buffer.output.begin() - synthesis_window_size + analysis_window_size,
-    buffer.output.end() - synthesis_window_size,
+    y.data() - synthesis_window_size + analysis_window_size,
+    y.data() + y.size() - synthesis_window_size,
     output.begin());
 
-  std::copy(
-    buffer.output.begin() + synthesis_window_size,
-    buffer.output.end(),
-    buffer.output.begin());
-
-  std::fill(
-    buffer.output.begin() + analysis_window_size,
-    buffer.output.end(),
-    0);
+  buffer.output->slide();
 }
@@ -3,6 +3,7 @@
 #include <voyx/Header.h>
 #include <voyx/alg/Vocoder.h>
 #include <voyx/dsp/SyncPipeline.h>
+#include <voyx/etc/SlidingBuffer.h>
 #include <voyx/io/MidiObserver.h>
 #include <voyx/ui/Plot.h>
 
@@ -18,6 +19,8 @@ public:
                          std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink,
                          std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot);
 
+  size_t latency() const override;
+
 protected:
 
   void operator()(const size_t index,
@@ -32,8 +35,8 @@ private:
 
   struct
   {
-    std::vector<double> input;
-    std::vector<double> output;
+    std::shared_ptr<SlidingBuffer<double>> input;
+    std::shared_ptr<SlidingBuffer<double>> output;
   }
   buffer;
 
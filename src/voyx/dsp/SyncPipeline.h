@@ -1,8 +1,11 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Allocation.h>
 #include <voyx/etc/Logger.h>
+#include <voyx/etc/Profiler.h>
 #include <voyx/etc/Timer.h>
+#include <voyx/etc/Tracer.h>
 #include <voyx/dsp/Pipeline.h>
 
 template<typename T = sample_t>
@@ -20,6 +23,12 @@ protected:
 
   void onstart(const size_t frames, const std::chrono::duration<double> timeout) override
   {
+    if (this->source->duplex())
+    {
+      duplex(frames);
+      return;
+    }
+
     doloop = true;
 
     thread = std::make_shared<std::thread>(
@@ -56,14 +65,66 @@ private:
   std::shared_ptr<std::thread> thread;
   bool doloop = false;
 
+  std::atomic<bool> done = false;
+
+  void duplex(const size_t frames)
+  {
+    done = false;
+
+    this->source->process([frames, this](const size_t index, const voyx::vector<T> input, voyx::vector<T> output)
+    {
+      if (frames > 0 && index >= frames)
+      {
+        output = T(0);
+        return;
+      }
+
+      {
+        voyxrealtime("SyncPipeline::process");
+        (*this)(index, input, output);
+      }
+
+      if (frames > 0 && index + 1 == frames)
+      {
+        done = true;
+      }
+    });
+
+    if (frames > 0)
+    {
+      // the stream may stop, fail or underrun before the last frame,
+      // so wait at most twice the expected duration
+      const std::chrono::duration<double> duration(frames * this->source->framesize() / this->source->samplerate());
+      const auto deadline = std::chrono::steady_clock::now() + duration * 2 + std::chrono::seconds(1);
+
+      while (!done)
+      {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+          this->source->stop();
+
+          throw std::runtime_error(
+            $("Duplex stream did not process {0} frames within {1:.3f} s!",
+              frames, (duration * 2 + std::chrono::seconds(1)).count()));
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+    }
+  }
+
   void loop(const size_t frames, const std::chrono::duration<double> timeout)
   {
+    voyx::tracer::name("SyncPipeline");
+
+    const std::chrono::duration<double> budget(this->sink->framesize() / this->sink->samplerate());
+
     struct
     {
       Timer<std::chrono::milliseconds> inner;
       Timer<std::chrono::milliseconds> outer;
     }
-    timers;
+    timers = { budget, budget };
 
     std::vector<T> output(this->sink->framesize());
 
@@ -81,6 +142,9 @@ private:
           timers.outer.toc();
           timers.outer.tic();
 
+          voyxtrace("SyncPipeline::process");
+          voyxrealtime("SyncPipeline::process");
+
           timers.inner.tic();
           (*this)(index, input, output);
           timers.inner.toc();
@@ -88,6 +152,8 @@ private:
 
         if (ok)
         {
+          voyxtrace("SyncPipeline::sink");
+
           this->sink->sync();
           this->sink->write(index, output);
         }
@@ -105,6 +171,8 @@ private:
         << "inner " << timers.inner.str() << "\t"
         << "outer " << timers.outer.str();
 
+      profile();
+
       timers.inner.cls();
       timers.outer.cls();
     }
@@ -131,6 +199,8 @@ private:
             << "inner " << timers.inner.str() << "\t"
             << "outer " << timers.outer.str();
 
+          profile();
+
           timers.inner.cls();
           timers.outer.cls();
 
@@ -142,6 +212,9 @@ private:
           timers.outer.toc();
           timers.outer.tic();
 
+          voyxtrace("SyncPipeline::process");
+          voyxrealtime("SyncPipeline::process");
+
           timers.inner.tic();
           (*this)(index, input, output);
           timers.inner.toc();
@@ -149,6 +222,8 @@ private:
 
         if (ok)
         {
+          voyxtrace("SyncPipeline::sink");
+
           this->sink->sync();
           this->sink->write(index, output);
         }
@@ -160,7 +235,33 @@ private:
           std::this_thread::sleep_for(timeout);
         }
       }
+
+      LOG(INFO)
+        << "Timing: \t"
+        << "inner " << timers.inner.str() << "\t"
+        << "outer " << timers.outer.str();
+
+      profile();
     }
   }
 
+  static void profile()
+  {
+    if (voyx::allocation::enabled())
+    {
+      LOG(INFO) << "Allocations: " << voyx::allocation::count() << voyx::allocation::str();
+
+      voyx::allocation::cls();
+    }
+
+    if (voyx::profiler::empty())
+    {
+      return;
+    }
+
+    LOG(INFO) << "Profile:" << voyx::profiler::str();
+
+    voyx::profiler::cls();
+  }
+
 };
@@ -4,19 +4,47 @@
 
 VoiceSynthPipeline::VoiceSynthPipeline(const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize,
                                        std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink,
-                                       std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot) :
-  StftPipeline(samplerate, framesize, hopsize, dftsize, source, sink),
+                                       std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot,
+                                       const bool parallel,
+                                       const EnvelopeEstimator estimator) :
+  StftPipeline(samplerate, framesize, hopsize, dftsize, source, sink, parallel),
   vocoder(samplerate, framesize, hopsize, dftsize),
-  lifter(1e-3, samplerate, dftsize * 2 - 2),
+  cache(0.05, std::max<size_t>(static_cast<size_t>(50e-3 * samplerate / framesize), 1)),
+  factors({ 0.5, 1.25, 1.5, 2 }),
   midi(midi),
   plot(plot)
 {
+  // construct only the selected envelope estimator,
+  // with an LPC order of about one coefficient per kilohertz
+  if (estimator == EnvelopeEstimator::LPC)
+  {
+    lpc.emplace(std::max<size_t>(static_cast<size_t>(samplerate / 1e3), 1), dftsize * 2 - 2);
+  }
+  else
+  {
+    lifter.emplace(1e-3, samplerate, dftsize * 2 - 2);
+  }
+
+  // one spectrum per STFT hop, allocated once up front
+  spectra.resize((framesize + hopsize - 1) / hopsize, dftsize);
+  buffers.resize(factors.size(), dftsize);
+  envelope.resize(dftsize);
+  mask.resize(dftsize);
+
   if (midi != nullptr)
   {
   }
 
   if (plot != nullptr)
   {
+    // keep an own plan and buffers, since the convenience
+    // $$::fft would allocate in each frame
+    plotting.fft.emplace(framesize);
+    plotting.window = $$::window<sample_t>(framesize);
+    plotting.frame.resize(framesize);
+    plotting.dft.resize(plotting.fft->dftsize());
+    plotting.abs.resize(plotting.fft->dftsize());
+
     plot->xmap(samplerate / 2);
     plot->xlim(0, 5e3);
     plot->ylim(-120, 0);
@@ -29,8 +57,14 @@ void VoiceSynthPipeline::operator()(const size_t index,
 {
   if (plot != nullptr)
   {
-    std::vector<std::complex<sample_t>> dft = $$::fft(signal);
-    std::vector<double> abs(dft.size());
+    auto& [fft, window, frame, dft, abs] = plotting;
+
+    for (size_t i = 0; i < frame.size(); ++i)
+    {
+      frame[i] = signal[i] * window[i];
+    }
+
+    fft->fft(frame, dft);
 
     for (size_t i = 0; i < dft.size(); ++i)
     {
@@ -40,48 +74,73 @@ void VoiceSynthPipeline::operator()(const size_t index,
     plot->plot(abs);
   }
 
-  vocoder.encode(dfts);
-
-  const std::vector<double> factors = { 0.5, 1.25, 1.5, 2 };
+  vocoder.encode(dfts, spectra);
 
   const double roi[] = { 0, samplerate / 2 };
 
-  std::vector<double> envelope(dfts.stride());
+  envelope.resize(spectra.bins());
+  buffers.resize(factors.size(), spectra.bins());
 
-  lifter.lowpass<$$::real>(dfts.front(), envelope);
+  buffers.magnitudes() = 0;
+  buffers.frequencies() = 0;
 
-  std::vector<phasor_t> buffer(factors.size() * dfts.stride());
-  voyx::matrix<phasor_t> buffers(buffer, dfts.stride());
+  if (cache.update(spectra.magnitude(0)))
+  {
+    if (lpc)
+    {
+      lpc->lowpass(spectra.magnitude(0), envelope);
+    }
+    else
+    {
+      lifter->lowpass(spectra.magnitude(0), envelope);
+    }
+  }
 
-  for (auto dft : dfts)
+  for (size_t k = 0; k < spectra.size(); ++k)
   {
-    lifter.divide<$$::real>(dft, envelope);
+    auto magnitude = spectra.magnitude(k);
+    auto frequency = spectra.frequency(k);
+
+    if (lpc)
+    {
+      lpc->divide(magnitude, envelope);
+    }
+    else
+    {
+      lifter->divide(magnitude, envelope);
+    }
 
     for (size_t i = 0; i < factors.size(); ++i)
     {
-      $$::interp(dft, buffers[i], factors[i]);
+      $$::interp(magnitude, buffers.magnitude(i), factors[i]);
+      $$::interp(frequency, buffers.frequency(i), factors[i]);
     }
 
-    const auto mask = $$::argmax<$$::real>(buffers);
+    // the mask covers only the bins, not the padded stride
+    $$::argmax<$$::real>(buffers.magnitudes(), mask);
 
-    for (size_t i = 0; i < dft.size(); ++i)
+    for (size_t i = 0; i < magnitude.size(); ++i)
     {
       const size_t j = mask[i];
 
-      dft[i] = buffers(j, i);
-
-      const auto frequency = dft[i].imag() * factors[j];
+      magnitude[i] = buffers.magnitudes()(j, i);
+      frequency[i] = buffers.frequencies()(j, i) * factors[j];
 
-      dft[i].imag(frequency);
-
-      if (frequency <= roi[0] || roi[1] <= frequency)
+      if (frequency[i] <= roi[0] || roi[1] <= frequency[i])
       {
-        dft[i].real(0);
+        magnitude[i] = 0;
       }
     }
 
-    lifter.multiply<$$::real>(dft, envelope);
+    if (lpc)
+    {
+      lpc->multiply(magnitude, envelope);
+    }
+    else
+    {
+      lifter->multiply(magnitude, envelope);
+    }
   }
 
-  vocoder.decode(dfts);
+  vocoder.decode(spectra, dfts);
 }
@@ -1,12 +1,25 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/alg/EnvelopeCache.h>
+#include <voyx/alg/FFT.h>
+#include <voyx/alg/LPC.h>
 #include <voyx/alg/Lifter.h>
 #include <voyx/alg/Vocoder.h>
 #include <voyx/dsp/StftPipeline.h>
 #include <voyx/io/MidiObserver.h>
 #include <voyx/ui/Plot.h>
 
+/**
+ * Spectral envelope estimators to choose from at construction,
+ * either the cepstral Lifter or the linear prediction LPC.
+ **/
+enum class EnvelopeEstimator
+{
+  Lifter,
+  LPC
+};
+
 class VoiceSynthPipeline : public StftPipeline<>
 {
 
@@ -14,7 +27,9 @@ public:
 
   VoiceSynthPipeline(const double samplerate, const size_t framesize, const size_t hopsize, const size_t dftsize,
                      std::shared_ptr<Source<sample_t>> source, std::shared_ptr<Sink<sample_t>> sink,
-                     std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot);
+                     std::shared_ptr<MidiObserver> midi, std::shared_ptr<Plot> plot,
+                     const bool parallel,
+                     const EnvelopeEstimator estimator = EnvelopeEstimator::Lifter);
 
   void operator()(const size_t index,
                   const voyx::vector<sample_t> signal,
@@ -22,10 +37,29 @@ public:
 
 private:
 
-  Vocoder<double> vocoder;
-  Lifter<double> lifter;
+  Vocoder<phasor_t::value_type> vocoder;
+  std::optional<Lifter<phasor_t::value_type>> lifter;
+  std::optional<LPC<phasor_t::value_type>> lpc;
+  EnvelopeCache<phasor_t::value_type> cache;
+
+  const std::vector<double> factors;
+
+  voyx::spectrum<phasor_t::value_type> spectra;
+  voyx::spectrum<phasor_t::value_type> buffers;
+  std::vector<phasor_t::value_type> envelope;
+  std::vector<size_t> mask;
 
   std::shared_ptr<MidiObserver> midi;
   std::shared_ptr<Plot> plot;
 
+  struct
+  {
+    std::optional<FFT<sample_t>> fft;
+    std::vector<sample_t> window;
+    std::vector<sample_t> frame;
+    std::vector<std::complex<sample_t>> dft;
+    std::vector<double> abs;
+  }
+  plotting;
+
 };
@@ -0,0 +1,193 @@
+#include <voyx/etc/Allocation.h>
+
+#include <cstdio>
+#include <new>
+
+namespace
+{
+  struct Slot
+  {
+    std::atomic<const char*> name = nullptr;
+    std::atomic<uint64_t> count = 0;
+    std::atomic<uint64_t> bytes = 0;
+  };
+
+  std::array<Slot, 64> slots;
+
+  std::atomic<voyx::allocation::Mode> guardmode = voyx::allocation::Mode::Count;
+}
+
+bool voyx::allocation::enabled()
+{
+  #ifdef VOYXALLOCGUARD
+  return true;
+  #else
+  return false;
+  #endif
+}
+
+void voyx::allocation::mode(const Mode mode)
+{
+  guardmode = mode;
+}
+
+voyx::allocation::Mode voyx::allocation::mode()
+{
+  return guardmode;
+}
+
+const char*& voyx::allocation::current()
+{
+  static thread_local const char* name = nullptr;
+  return name;
+}
+
+void voyx::allocation::track(const size_t size)
+{
+  const char* name = current();
+
+  if (name == nullptr)
+  {
+    return;
+  }
+
+  if (guardmode == Mode::Abort)
+  {
+    // avoid any further allocation while reporting
+    std::fprintf(stderr, "Heap allocation of %zu bytes in realtime section %s!\n", size, name);
+    std::abort();
+  }
+
+  for (auto& slot : slots)
+  {
+    const char* expected = slot.name.load(std::memory_order_relaxed);
+
+    if (expected == nullptr)
+    {
+      slot.name.compare_exchange_strong(expected, name);
+      expected = slot.name.load(std::memory_order_relaxed);
+    }
+
+    if (expected == name)
+    {
+      slot.count.fetch_add(1, std::memory_order_relaxed);
+      slot.bytes.fetch_add(size, std::memory_order_relaxed);
+      return;
+    }
+  }
+}
+
+uint64_t voyx::allocation::count()
+{
+  uint64_t count = 0;
+
+  for (const auto& slot : slots)
+  {
+    count += slot.count.load(std::memory_order_relaxed);
+  }
+
+  return count;
+}
+
+void voyx::allocation::cls()
+{
+  for (auto& slot : slots)
+  {
+    slot.count = 0;
+    slot.bytes = 0;
+  }
+}
+
+std::string voyx::allocation::str()
+{
+  std::ostringstream result;
+
+  for (const auto& slot : slots)
+  {
+    const char* name = slot.name.load(std::memory_order_relaxed);
+
+    if (name == nullptr)
+    {
+      break;
+    }
+
+    const uint64_t count = slot.count.load(std::memory_order_relaxed);
+
+    if (!count)
+    {
+      continue;
+    }
+
+    result << std::endl
+           << std::left << std::setw(32) << name
+           << count << " allocations "
+           << slot.bytes.load(std::memory_order_relaxed) << " bytes";
+  }
+
+  return result.str();
+}
+
+#ifdef VOYXALLOCGUARD
+
+void* operator new(std::size_t size)
+{
+  voyx::allocation::track(size);
+
+  if (void* pointer = std::malloc(size ? size : 1))
+  {
+    return pointer;
+  }
+
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  voyx::allocation::track(size);
+
+  const size_t bytes = static_cast<size_t>(alignment);
+  const size_t aligned = (std::max<size_t>(size, 1) + bytes - 1) / bytes * bytes;
+
+  #ifdef _MSC_VER
+  void* pointer = _aligned_malloc(aligned, bytes);
+  #else
+  void* pointer = std::aligned_alloc(bytes, aligned);
+  #endif
+
+  if (pointer)
+  {
+    return pointer;
+  }
+
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t size) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept
+{
+  #ifdef _MSC_VER
+  _aligned_free(pointer);
+  #else
+  std::free(pointer);
+  #endif
+}
+
+void operator delete(void* pointer, std::size_t size, std::align_val_t alignment) noexcept
+{
+  #ifdef _MSC_VER
+  _aligned_free(pointer);
+  #else
+  std::free(pointer);
+  #endif
+}
+
+#endif
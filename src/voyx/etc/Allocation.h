@@ -0,0 +1,65 @@
+#pragma once
+
+#include <voyx/Header.h>
+
+#define voyxrealtimejoin(a, b) a##b
+#define voyxrealtimeconcat(a, b) voyxrealtimejoin(a, b)
+
+#ifdef VOYXALLOCGUARD
+#define voyxrealtime(name) \
+  const voyx::allocation::section voyxrealtimeconcat(voyxrealtimesection, __LINE__)(name);
+#else
+#define voyxrealtime(name)
+#endif
+
+namespace voyx
+{
+  /**
+   * Tracks heap allocations inside realtime sections.
+   *
+   * If VOYXALLOCGUARD is defined, the global operator new is replaced
+   * and each allocation performed while the calling thread is inside
+   * a voyxrealtime("name") scope is either counted per section or,
+   * in the abort mode, terminates the process immediately.
+   * Otherwise the voyxrealtime macro expands to nothing.
+   **/
+  struct allocation
+  {
+    enum class Mode
+    {
+      Count,
+      Abort
+    };
+
+    struct section
+    {
+      section(const char* name) :
+        previous(current())
+      {
+        current() = name;
+      }
+
+      ~section()
+      {
+        current() = previous;
+      }
+
+      const char* const previous;
+    };
+
+    static bool enabled();
+
+    static void mode(const Mode mode);
+    static Mode mode();
+
+    static void track(const size_t size);
+
+    static uint64_t count();
+    static void cls();
+    static std::string str();
+
+  private:
+
+    static const char*& current();
+  };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Profiler.h>
 
 namespace $$
 {
@@ -97,19 +98,31 @@ namespace $$
 
   // TODO: use xtensor
 
+  /**
+   * Stores the index of the maximum along the specified axis
+   * into the preallocated indices, whose size determines the number
+   * of leading columns or rows to reduce, e.g. only the bins
+   * of a spectrum without the padding of its stride.
+   **/
   template<typename value_getter_t, typename T>
-  std::vector<size_t> argmax(const voyx::matrix<T> matrix, const size_t axis = 0)
+  void argmax(const voyx::matrix<T> matrix, voyx::vector<size_t> indices, const size_t axis = 0)
   {
+    voyxprofile("$$::argmax");
+
     using value_t = typename $$::typeofvalue<T>::type;
     const value_getter_t getvalue;
 
     static_assert(std::is_arithmetic<value_t>::value);
 
-    std::vector<size_t> indices;
+    if (axis > 1)
+    {
+      throw std::runtime_error("Invalid axis index!");
+    }
 
     if (matrix.empty())
     {
-      return indices;
+      voyxassert(indices.empty());
+      return;
     }
 
     const size_t shape[] =
@@ -120,9 +133,9 @@ namespace $$
 
     if (axis == 0)
     {
-      indices.resize(shape[1]);
+      voyxassert(indices.size() <= shape[1]);
 
-      for (size_t i = 0; i < shape[1]; ++i)
+      for (size_t i = 0; i < indices.size(); ++i)
       {
         value_t value = getvalue(matrix(0, i));
         size_t index = 0;
@@ -139,11 +152,11 @@ namespace $$
         indices[i] = index;
       }
     }
-    else if (axis == 1)
+    else
     {
-      indices.resize(shape[0]);
+      voyxassert(indices.size() <= shape[0]);
 
-      for (size_t i = 0; i < shape[0]; ++i)
+      for (size_t i = 0; i < indices.size(); ++i)
       {
         value_t value = getvalue(matrix(i, 0));
         size_t index = 0;
@@ -160,11 +173,13 @@ namespace $$
         indices[i] = index;
       }
     }
-    else
-    {
-      throw std::runtime_error("Invalid axis index!");
-    }
+  }
 
+  template<typename value_getter_t, typename T>
+  std::vector<size_t> argmax(const voyx::matrix<T> matrix, const size_t axis = 0)
+  {
+    std::vector<size_t> indices(matrix.empty() ? 0 : (axis == 0 ? matrix.stride() : matrix.size()));
+    argmax<value_getter_t>(matrix, indices, axis);
     return indices;
   }
 }
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <voyx/Header.h>
+
+namespace $$
+{
+  /**
+   * Flattens the specified values by the spectral envelope,
+   * or zeros them where the envelope is not a normal number.
+   **/
+  template<typename T>
+  void envdiv(voyx::vector<T> values, const voyx::vector<T> envelope)
+  {
+    voyxassert(values.size() <= envelope.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      const bool ok = std::isnormal(envelope[i]);
+
+      values[i] = ok ? values[i] / envelope[i] : 0;
+    }
+  }
+
+  /**
+   * Restores the specified values by the spectral envelope,
+   * or zeros them where the envelope is not a normal number.
+   **/
+  template<typename T>
+  void envmul(voyx::vector<T> values, const voyx::vector<T> envelope)
+  {
+    voyxassert(values.size() <= envelope.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      const bool ok = std::isnormal(envelope[i]);
+
+      values[i] = ok ? values[i] * envelope[i] : 0;
+    }
+  }
+
+  template<typename value_getter_setter_t, typename T>
+  void envdiv(voyx::vector<std::complex<T>> dft, const voyx::vector<T> envelope)
+  {
+    voyxassert(dft.size() <= envelope.size());
+
+    const value_getter_setter_t value;
+
+    for (size_t i = 0; i < dft.size(); ++i)
+    {
+      const bool ok = std::isnormal(envelope[i]);
+
+      value(dft[i], ok ? value(dft[i]) / envelope[i] : 0);
+    }
+  }
+
+  template<typename value_getter_setter_t, typename T>
+  void envmul(voyx::vector<std::complex<T>> dft, const voyx::vector<T> envelope)
+  {
+    voyxassert(dft.size() <= envelope.size());
+
+    const value_getter_setter_t value;
+
+    for (size_t i = 0; i < dft.size(); ++i)
+    {
+      const bool ok = std::isnormal(envelope[i]);
+
+      value(dft[i], ok ? value(dft[i]) * envelope[i] : 0);
+    }
+  }
+}
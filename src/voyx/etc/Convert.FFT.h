@@ -5,12 +5,37 @@
 
 namespace $$
 {
+  /**
+   * Returns the FFT instance of the specified framesize, which is
+   * created once per thread, so that repeated calls neither autotune
+   * nor create a new plan.
+   *
+   * The first call per thread and framesize allocates, just like
+   * the returned vectors of the fft functions below. So these are
+   * convenience functions for offline use, realtime callers
+   * should keep their own FFT instance and buffers instead.
+   **/
+  template<typename T>
+  FFT<T>& fftplan(const size_t framesize)
+  {
+    thread_local std::map<size_t, std::unique_ptr<FFT<T>>> plans;
+
+    auto& plan = plans[framesize];
+
+    if (plan == nullptr)
+    {
+      plan = std::make_unique<FFT<T>>(framesize);
+    }
+
+    return *plan;
+  }
+
   template<typename T>
   std::vector<std::complex<T>> fft(const voyx::vector<T> samples, const voyx::vector<T> window)
   {
     voyxassert(samples.size() == window.size());
 
-    FFT<T> fft(samples.size());
+    FFT<T>& fft = $$::fftplan<T>(samples.size());
 
     std::vector<T> product(fft.framesize());
     std::vector<std::complex<T>> dft(fft.dftsize());
@@ -28,7 +53,14 @@ namespace $$
   template<typename T>
   std::vector<std::complex<T>> fft(const voyx::vector<T> samples)
   {
-    const std::vector<T> window = $$::window<T>(samples.size());
+    thread_local std::map<size_t, std::vector<T>> windows;
+
+    auto& window = windows[samples.size()];
+
+    if (window.empty())
+    {
+      window = $$::window<T>(samples.size());
+    }
 
     return $$::fft(samples, voyx::vector(window));
   }
@@ -1,54 +1,41 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Harmonics.h>
 
 // http://musicweb.ucsd.edu/~trsmyth/analysis/Harmonic_Product_Spectrum.html
 
 namespace $$
 {
   template<typename T>
-  std::vector<T> hpsmul(const std::vector<T>& vector, const size_t depth, const T empty = 0)
+  void hpsmul(const voyx::vector<T> vector, voyx::vector<T> product, const size_t depth, const T empty = 0)
   {
-    std::vector<T> product(vector.begin(), vector.end());
+    voyxassert(product.size() == vector.size());
 
-    for (size_t step = 2; step < depth + 2; ++step)
-    {
-      std::vector<T> harmonic(vector.size(), empty);
+    voyx::harmonics::multiply(vector.data(), product.data(), vector.size(), depth, empty);
+  }
 
-      for (size_t i = 0, j = 0; i < vector.size(); i += step, j += 1)
-      {
-        harmonic[j] = vector[i];
-      }
+  template<typename T>
+  void hpsadd(const voyx::vector<T> vector, voyx::vector<T> product, const size_t depth, const T empty = -120)
+  {
+    voyxassert(product.size() == vector.size());
 
-      for (size_t i = 0; i < vector.size(); ++i)
-      {
-        product[i] /* multiply */ *= harmonic[i];
-      }
-    }
+    voyx::harmonics::add(vector.data(), product.data(), vector.size(), depth, empty);
+  }
 
+  template<typename T>
+  std::vector<T> hpsmul(const std::vector<T>& vector, const size_t depth, const T empty = 0)
+  {
+    std::vector<T> product(vector.size());
+    hpsmul<T>(vector, product, depth, empty);
     return product;
   }
 
   template<typename T>
   std::vector<T> hpsadd(const std::vector<T>& vector, const size_t depth, const T empty = -120)
   {
-    std::vector<T> product(vector.begin(), vector.end());
-
-    for (size_t step = 2; step < depth + 2; ++step)
-    {
-      std::vector<T> harmonic(vector.size(), empty);
-
-      for (size_t i = 0, j = 0; i < vector.size(); i += step, j += 1)
-      {
-        harmonic[j] = vector[i];
-      }
-
-      for (size_t i = 0; i < vector.size(); ++i)
-      {
-        product[i] /* add */ += harmonic[i];
-      }
-    }
-
+    std::vector<T> product(vector.size());
+    hpsadd<T>(vector, product, depth, empty);
     return product;
   }
 }
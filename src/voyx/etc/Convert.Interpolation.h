@@ -1,6 +1,7 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Profiler.h>
 
 #include <mlinterp.hpp>
 
@@ -55,6 +56,8 @@ namespace $$
   template<typename T>
   static inline void interp(const size_t size, const T* x, T* const y, const double factor)
   {
+    voyxprofile("$$::interp");
+
     using V = typename $$::typeofvalue<T>::type;
 
     const ptrdiff_t n = static_cast<ptrdiff_t>(size);
@@ -11,6 +11,7 @@
 #include <voyx/etc/Convert.FFT.h>
 #include <voyx/etc/Convert.MIDI.h>
 #include <voyx/etc/Convert.HPS.h>
+#include <voyx/etc/Convert.Envelope.h>
 
 #include <voyx/etc/Convert.String.h>
 #include <voyx/etc/Convert.Type.h>
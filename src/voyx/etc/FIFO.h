@@ -1,6 +1,7 @@
 #pragma once
 
 #include <voyx/Header.h>
+#include <voyx/etc/Tracer.h>
 
 #include <readerwriterqueue.h>
 
@@ -72,8 +73,14 @@ public:
   bool write(const std::chrono::duration<R, P>& timeout, std::function<void(T& value)> callback)
   {
     T* value;
+    bool ok;
 
-    if (!done.wait_dequeue_timed(value, timeout))
+    {
+      voyxtrace("FIFO::write");
+      ok = done.wait_dequeue_timed(value, timeout);
+    }
+
+    if (!ok)
     {
       return false;
     }
@@ -105,8 +112,14 @@ public:
   bool read(const std::chrono::duration<R, P>& timeout, std::function<void(T& value)> callback)
   {
     T* value;
+    bool ok;
+
+    {
+      voyxtrace("FIFO::read");
+      ok = todo.wait_dequeue_timed(value, timeout);
+    }
 
-    if (!todo.wait_dequeue_timed(value, timeout))
+    if (!ok)
     {
       return false;
     }
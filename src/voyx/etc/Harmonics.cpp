@@ -0,0 +1,81 @@
+#include <voyx/etc/Harmonics.h>
+
+#include <voyx/etc/SIMD.h>
+
+namespace
+{
+  /**
+   * Accumulates the decimations of each block of output values
+   * while the block is still in the cache. Within a block the
+   * strided input of a decimation is contiguous in the output,
+   * so the inner loops vectorize by gather instructions.
+   **/
+  template<typename T, typename F>
+  inline void hps(const T* VOYXRESTRICT x, T* VOYXRESTRICT y, const size_t n, const size_t depth, const T empty, F&& op)
+  {
+    const size_t block = 256;
+
+    for (size_t i0 = 0; i0 < n; i0 += block)
+    {
+      const size_t m = std::min(block, n - i0);
+
+      T* VOYXRESTRICT z = y + i0;
+
+      for (size_t i = 0; i < m; ++i)
+      {
+        z[i] = x[i0 + i];
+      }
+
+      for (size_t step = 2; step < depth + 2; ++step)
+      {
+        // number of decimated values within the input
+        const size_t end = (n - 1) / step + 1;
+        const size_t valid = std::clamp(end, i0, i0 + m) - i0;
+
+        const T* VOYXRESTRICT w = x + i0 * step;
+
+        for (size_t i = 0; i < valid; ++i)
+        {
+          z[i] = op(z[i], w[i * step]);
+        }
+
+        for (size_t i = valid; i < m; ++i)
+        {
+          z[i] = op(z[i], empty);
+        }
+      }
+    }
+  }
+
+  template<typename T>
+  inline void multiply(const T* VOYXRESTRICT x, T* VOYXRESTRICT y, const size_t n, const size_t depth, const T empty)
+  {
+    hps(x, y, n, depth, empty, [](const T a, const T b) { return a * b; });
+  }
+
+  template<typename T>
+  inline void add(const T* VOYXRESTRICT x, T* VOYXRESTRICT y, const size_t n, const size_t depth, const T empty)
+  {
+    hps(x, y, n, depth, empty, [](const T a, const T b) { return a + b; });
+  }
+}
+
+VOYXCLONES void voyx::harmonics::multiply(const float* x, float* y, const size_t n, const size_t depth, const float empty)
+{
+  ::multiply(x, y, n, depth, empty);
+}
+
+VOYXCLONES void voyx::harmonics::multiply(const double* x, double* y, const size_t n, const size_t depth, const double empty)
+{
+  ::multiply(x, y, n, depth, empty);
+}
+
+VOYXCLONES void voyx::harmonics::add(const float* x, float* y, const size_t n, const size_t depth, const float empty)
+{
+  ::add(x, y, n, depth, empty);
+}
+
+VOYXCLONES void voyx::harmonics::add(const double* x, double* y, const size_t n, const size_t depth, const double empty)
+{
+  ::add(x, y, n, depth, empty);
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <voyx/Header.h>
+
+namespace voyx
+{
+  /**
+   * Runtime dispatched harmonic product spectrum kernels.
+   *
+   * All decimations are fused into a single blockwise pass over the output,
+   * so neither intermediate vectors nor repeated passes are required.
+   * The input and output must not overlap.
+   **/
+  namespace harmonics
+  {
+    /**
+     * Computes y[i] = x[i] * x[2i] * ... * x[(depth+1)i],
+     * where each x[ki] beyond the input is replaced by the empty value.
+     **/
+    void multiply(const float* x, float* y, const size_t n, const size_t depth, const float empty);
+    void multiply(const double* x, double* y, const size_t n, const size_t depth, const double empty);
+
+    /**
+     * Computes y[i] = x[i] + x[2i] + ... + x[(depth+1)i],
+     * where each x[ki] beyond the input is replaced by the empty value.
+     **/
+    void add(const float* x, float* y, const size_t n, const size_t depth, const float empty);
+    void add(const double* x, double* y, const size_t n, const size_t depth, const double empty);
+  }
+}
@@ -0,0 +1,180 @@
+#include <voyx/etc/Lifting.h>
+
+#include <voyx/etc/SIMD.h>
+
+namespace
+{
+  template<typename T>
+  struct Bits;
+
+  template<>
+  struct Bits<float>
+  {
+    using type = uint32_t;
+
+    static const int mantissa = 23;
+    static const int bias = 127;
+  };
+
+  template<>
+  struct Bits<double>
+  {
+    using type = uint64_t;
+
+    static const int mantissa = 52;
+    static const int bias = 1023;
+  };
+
+  /**
+   * Natural logarithm of x > 0 by splitting x into 2^e * m
+   * with m in [sqrt(0.5), sqrt(2)) and the odd atanh series
+   * ln(m) = 2 * (t + t^3/3 + t^5/5 + ...) with t = (m - 1) / (m + 1).
+   **/
+  template<typename T>
+  inline T fastlog(const T x)
+  {
+    using U = typename Bits<T>::type;
+
+    const U bits = std::bit_cast<U>(x);
+
+    // only the exponent bits are needed, so a 32 bit integer suffices
+    // and keeps the conversion vectorizable without AVX-512DQ
+    const int32_t exponent = static_cast<int32_t>(bits >> Bits<T>::mantissa) - Bits<T>::bias;
+
+    const U mask = (U(1) << Bits<T>::mantissa) - 1;
+    const U one = U(Bits<T>::bias) << Bits<T>::mantissa;
+
+    T m = std::bit_cast<T>((bits & mask) | one);
+    T e = static_cast<T>(exponent);
+
+    const bool high = m > T(1.41421356237309504880);
+
+    m = high ? m * T(0.5) : m;
+    e = high ? e + 1 : e;
+
+    const T t = (m - 1) / (m + 1);
+    const T t2 = t * t;
+
+    const T p = t * (T(2) + t2 * (T(2.0 / 3) + t2 * (T(2.0 / 5) + t2 * (T(2.0 / 7) +
+                t2 * (T(2.0 / 9) + t2 * (T(2.0 / 11) + t2 * T(2.0 / 13)))))));
+
+    return e * T(0.69314718055994530942) + p;
+  }
+
+  /**
+   * Natural exponential by splitting x / ln(2) into the integer part n
+   * and the remainder f in [-0.5, 0.5], i.e. e^x = 2^n * e^(f * ln(2)).
+   **/
+  template<typename T>
+  inline T fastexp(const T x)
+  {
+    using U = typename Bits<T>::type;
+
+    const T z = std::clamp(x * T(1.44269504088896340736), T(1 - Bits<T>::bias), T(Bits<T>::bias));
+    const T n = std::floor(z + T(0.5));
+    const T u = (z - n) * T(0.69314718055994530942);
+
+    const T p = T(1) + u * (T(1) + u * (T(1.0 / 2) + u * (T(1.0 / 6) + u * (T(1.0 / 24) + u * (T(1.0 / 120) +
+                u * (T(1.0 / 720) + u * (T(1.0 / 5040) + u * (T(1.0 / 40320) + u * (T(1.0 / 362880) +
+                u * T(1.0 / 3628800))))))))));
+
+    const U scale = static_cast<U>(static_cast<int32_t>(n) + Bits<T>::bias) << Bits<T>::mantissa;
+
+    return p * std::bit_cast<T>(scale);
+  }
+
+  template<typename T>
+  inline void fastlog10(const T* VOYXRESTRICT x, T* VOYXRESTRICT y, const size_t n)
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      const T value = std::max(x[i], std::numeric_limits<T>::min());
+
+      y[i] = (x[i] > 0) ? fastlog(value) * T(0.43429448190325182765) : T(-12);
+    }
+  }
+
+  template<typename T>
+  inline void fastpow10(const T* VOYXRESTRICT x, T* VOYXRESTRICT y, const size_t n)
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      y[i] = fastexp(x[i] * T(2.30258509299404568402));
+    }
+  }
+
+  template<typename T>
+  inline void project(const T* VOYXRESTRICT a, const T* VOYXRESTRICT x, T* VOYXRESTRICT y, const size_t rows, const size_t cols, const size_t stride)
+  {
+    for (size_t i = 0; i < rows; ++i)
+    {
+      const T* row = a + i * stride;
+
+      T sum = 0;
+
+      for (size_t j = 0; j < cols; ++j)
+      {
+        sum += row[j] * x[j];
+      }
+
+      y[i] = sum;
+    }
+  }
+
+  template<typename T>
+  inline void superpose(const T* VOYXRESTRICT a, const T* VOYXRESTRICT x, T* VOYXRESTRICT y, const size_t rows, const size_t cols, const size_t stride)
+  {
+    std::fill(y, y + cols, T(0));
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+      const T* row = a + i * stride;
+      const T value = x[i];
+
+      for (size_t j = 0; j < cols; ++j)
+      {
+        y[j] += row[j] * value;
+      }
+    }
+  }
+}
+
+VOYXCLONES void voyx::lifting::log10(const float* x, float* y, const size_t n)
+{
+  ::fastlog10(x, y, n);
+}
+
+VOYXCLONES void voyx::lifting::log10(const double* x, double* y, const size_t n)
+{
+  ::fastlog10(x, y, n);
+}
+
+VOYXCLONES void voyx::lifting::pow10(const float* x, float* y, const size_t n)
+{
+  ::fastpow10(x, y, n);
+}
+
+VOYXCLONES void voyx::lifting::pow10(const double* x, double* y, const size_t n)
+{
+  ::fastpow10(x, y, n);
+}
+
+VOYXCLONES void voyx::lifting::project(const float* a, const float* x, float* y, const size_t rows, const size_t cols, const size_t stride)
+{
+  ::project(a, x, y, rows, cols, stride);
+}
+
+VOYXCLONES void voyx::lifting::project(const double* a, const double* x, double* y, const size_t rows, const size_t cols, const size_t stride)
+{
+  ::project(a, x, y, rows, cols, stride);
+}
+
+VOYXCLONES void voyx::lifting::superpose(const float* a, const float* x, float* y, const size_t rows, const size_t cols, const size_t stride)
+{
+  ::superpose(a, x, y, rows, cols, stride);
+}
+
+VOYXCLONES void voyx::lifting::superpose(const double* a, const double* x, double* y, const size_t rows, const size_t cols, const size_t stride)
+{
+  ::superpose(a, x, y, rows, cols, stride);
+}
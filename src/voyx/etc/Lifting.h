@@ -0,0 +1,40 @@
+#pragma once
+
+#include <voyx/Header.h>
+
+namespace voyx
+{
+  /**
+   * Runtime dispatched kernels of the cepstral envelope estimation.
+   *
+   * The logarithm and exponential are branchless polynomial approximations,
+   * accurate to about 1e-12 in double and 1e-5 in single precision,
+   * which allows the loops to be vectorized.
+   **/
+  namespace lifting
+  {
+    /**
+     * Computes y[i] = log10(x[i]) or -12 if x[i] is zero.
+     **/
+    void log10(const float* x, float* y, const size_t n);
+    void log10(const double* x, double* y, const size_t n);
+
+    /**
+     * Computes y[i] = 10^x[i].
+     **/
+    void pow10(const float* x, float* y, const size_t n);
+    void pow10(const double* x, double* y, const size_t n);
+
+    /**
+     * Computes y[i] = sum(a[i * stride + j] * x[j]) for i < rows and j < cols.
+     **/
+    void project(const float* a, const float* x, float* y, const size_t rows, const size_t cols, const size_t stride);
+    void project(const double* a, const double* x, double* y, const size_t rows, const size_t cols, const size_t stride);
+
+    /**
+     * Computes y[j] = sum(a[i * stride + j] * x[i]) for i < rows and j < cols.
+     **/
+    void superpose(const float* a, const float* x, float* y, const size_t rows, const size_t cols, const size_t stride);
+    void superpose(const double* a, const double* x, double* y, const size_t rows, const size_t cols, const size_t stride);
+  }
+}
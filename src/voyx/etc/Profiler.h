@@ -0,0 +1,158 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/etc/Timer.h>
+
+#define voyxprofilejoin(a, b) a##b
+#define voyxprofileconcat(a, b) voyxprofilejoin(a, b)
+
+#ifdef VOYXPROFILE
+#define voyxprofile(name)                                                                                    \
+  static auto& voyxprofileconcat(voyxprofiletimer, __LINE__) = voyx::profiler::timer(name);                 \
+  const voyx::profiler::scope voyxprofileconcat(voyxprofilescope, __LINE__)(voyxprofileconcat(voyxprofiletimer, __LINE__));
+#else
+#define voyxprofile(name)
+#endif
+
+namespace voyx
+{
+  /**
+   * Collects the duration of named hot-path stages.
+   *
+   * Use the voyxprofile("name") macro at the beginning of a scope,
+   * which expands to nothing unless VOYXPROFILE is defined.
+   * Each call site looks up its timer only once, afterwards
+   * the measurement itself neither allocates nor locks.
+   *
+   * The timers live in a fixed static table, since the lookup
+   * happens at the first call of a call site, which is usually
+   * inside a realtime section. So even the lookup neither allocates
+   * nor takes a mutex, but only spins briefly while another call site
+   * is claiming a slot. The name must be a string literal.
+   **/
+  struct profiler
+  {
+    struct scope
+    {
+      scope(Timer<std::chrono::microseconds>& timer) :
+        timer(timer),
+        timestamp(std::chrono::steady_clock::now())
+      {
+      }
+
+      ~scope()
+      {
+        timer.add(std::chrono::steady_clock::now() - timestamp);
+      }
+
+      Timer<std::chrono::microseconds>& timer;
+      const std::chrono::time_point<std::chrono::steady_clock> timestamp;
+    };
+
+    static Timer<std::chrono::microseconds>& timer(const char* name)
+    {
+      auto& registry = profiler::registry();
+
+      while (registry.lock.test_and_set(std::memory_order_acquire))
+      {
+      }
+
+      const size_t count = registry.count.load(std::memory_order_relaxed);
+
+      size_t index = 0;
+
+      while (index < count && std::strcmp(registry.names[index], name) != 0)
+      {
+        ++index;
+      }
+
+      if (index == count)
+      {
+        // the last slot collects all call sites beyond the capacity
+        index = std::min(count, capacity - 1);
+
+        registry.names[index] = (index < capacity - 1) ? name : "...";
+        registry.count.store(index + 1, std::memory_order_release);
+      }
+
+      registry.lock.clear(std::memory_order_release);
+
+      return registry.timers[index];
+    }
+
+    static bool empty()
+    {
+      return registry().count.load(std::memory_order_acquire) == 0;
+    }
+
+    static void cls()
+    {
+      auto& registry = profiler::registry();
+
+      const size_t count = registry.count.load(std::memory_order_acquire);
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        registry.timers[i].cls();
+      }
+    }
+
+    static std::string str()
+    {
+      auto& registry = profiler::registry();
+
+      const size_t count = registry.count.load(std::memory_order_acquire);
+
+      std::vector<size_t> indices(count);
+      std::iota(indices.begin(), indices.end(), 0);
+
+      std::sort(indices.begin(), indices.end(), [&](const size_t a, const size_t b)
+      {
+        return std::strcmp(registry.names[a], registry.names[b]) < 0;
+      });
+
+      size_t width = 0;
+
+      for (const size_t i : indices)
+      {
+        width = std::max(width, std::strlen(registry.names[i]));
+      }
+
+      std::ostringstream result;
+
+      for (const size_t i : indices)
+      {
+        const auto& timer = registry.timers[i];
+
+        if (!timer.size())
+        {
+          continue;
+        }
+
+        result << std::endl
+               << std::left << std::setw(width + 2) << registry.names[i]
+               << timer.str();
+      }
+
+      return result.str();
+    }
+
+  private:
+
+    static const size_t capacity = 128;
+
+    struct Registry
+    {
+      std::atomic_flag lock = ATOMIC_FLAG_INIT;
+      std::atomic<size_t> count = 0;
+      std::array<const char*, capacity> names = {};
+      std::array<Timer<std::chrono::microseconds>, capacity> timers;
+    };
+
+    static Registry& registry()
+    {
+      static Registry registry;
+      return registry;
+    }
+  };
+}
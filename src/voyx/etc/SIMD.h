@@ -0,0 +1,52 @@
+#pragma once
+
+#include <voyx/Header.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__) && defined(__linux__)
+#define VOYXCLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#define VOYXCLONESX86
+#else
+#define VOYXCLONES
+#endif
+
+#ifdef _MSC_VER
+#define VOYXRESTRICT __restrict
+#else
+#define VOYXRESTRICT __restrict__
+#endif
+
+namespace voyx
+{
+  /**
+   * Runtime dispatched kernels are declared with VOYXCLONES.
+   *
+   * On x86 Linux builds with GCC or Clang each such kernel is compiled
+   * for AVX-512, AVX2 and the baseline instruction set, and the
+   * best fitting version is selected once at load time.
+   * Elsewhere only the auto-vectorized baseline version is built.
+   **/
+  namespace simd
+  {
+    /**
+     * Returns the instruction set selected at runtime, e.g. "avx2".
+     **/
+    inline std::string isa()
+    {
+      #ifdef VOYXCLONESX86
+      __builtin_cpu_init();
+
+      if (__builtin_cpu_supports("avx512f"))
+      {
+        return "avx512f";
+      }
+
+      if (__builtin_cpu_supports("avx2"))
+      {
+        return "avx2";
+      }
+      #endif
+
+      return "default";
+    }
+  }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/etc/Vector.h>
+
+/**
+ * Contiguous window of the specified size, which slides over
+ * an oversized buffer by the specified step instead of shifting
+ * its content on each advance.
+ *
+ * The remaining part of the window is moved back to the beginning
+ * of the buffer only when the buffer end is reached, i.e. once per
+ * about size/step advances, so the amortized copy traffic per advance
+ * is bounded by the step instead of the window size.
+ *
+ * Samples entering the window from the right are always zero.
+ **/
+template<typename T>
+class SlidingBuffer
+{
+
+public:
+
+  SlidingBuffer(const size_t size, const size_t step) :
+    size(size),
+    step(step),
+    offset(0),
+    buffer(size + step * std::max<size_t>((size + step - 1) / std::max<size_t>(step, 1), 1))
+  {
+    voyxassert(step > 0 && step <= size);
+  }
+
+  voyx::vector<T> window()
+  {
+    return voyx::vector<T>(buffer.data() + offset, size);
+  }
+
+  const voyx::vector<T> window() const
+  {
+    return voyx::vector<T>(buffer.data() + offset, size);
+  }
+
+  void slide()
+  {
+    if (offset + size + step <= buffer.size())
+    {
+      // the newly exposed samples are still zero
+      // since the last compaction or construction
+      offset += step;
+      return;
+    }
+
+    const auto begin = buffer.begin() + offset + step;
+    const auto end = buffer.begin() + offset + size;
+
+    std::copy(begin, end, buffer.begin());
+    std::fill(buffer.begin() + (size - step), buffer.end(), T(0));
+
+    offset = 0;
+  }
+
+private:
+
+  const size_t size;
+  const size_t step;
+
+  size_t offset;
+  std::vector<T> buffer;
+
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <voyx/Header.h>
+
+namespace voyx
+{
+  /**
+   * Structure-of-arrays storage of one or more vocoded spectra,
+   * i.e. separate contiguous magnitude and frequency rows
+   * instead of interleaved std::complex value pairs.
+   *
+   * Each row is aligned to the cache line size and padded
+   * to a multiple of it, so that loops over individual rows
+   * are not split by unaligned or partial SIMD vectors.
+   **/
+  template<typename T>
+  class spectrum
+  {
+
+  public:
+
+    static_assert(std::is_trivial<T>::value);
+
+    static const size_t alignment = 64;
+
+    spectrum() :
+      spectrum(0, 0)
+    {
+    }
+
+    spectrum(const size_t size, const size_t bins)
+    {
+      resize(size, bins);
+    }
+
+    /**
+     * Reallocates the storage only if the shape changes.
+     **/
+    void resize(const size_t size, const size_t bins)
+    {
+      const size_t lanes = alignment / sizeof(T);
+      const size_t stride = (bins + lanes - 1) / lanes * lanes;
+
+      if (size == spectrum_size && bins == spectrum_bins)
+      {
+        return;
+      }
+
+      spectrum_size = size;
+      spectrum_bins = bins;
+      spectrum_stride = stride;
+
+      const size_t count = 2 * size * stride;
+
+      spectrum_data.reset(count ? static_cast<T*>(::operator new[](count * sizeof(T), std::align_val_t(alignment))) : nullptr);
+
+      std::fill(spectrum_data.get(), spectrum_data.get() + count, T(0));
+    }
+
+    size_t size() const { return spectrum_size; }
+    size_t bins() const { return spectrum_bins; }
+    size_t stride() const { return spectrum_stride; }
+    bool empty() const { return spectrum_size == 0 || spectrum_bins == 0; }
+
+    voyx::vector<T> magnitude(const size_t i)
+    {
+      return voyx::vector<T>(magnitudes().data() + i * spectrum_stride, spectrum_bins);
+    }
+
+    const voyx::vector<T> magnitude(const size_t i) const
+    {
+      return voyx::vector<T>(magnitudes().data() + i * spectrum_stride, spectrum_bins);
+    }
+
+    voyx::vector<T> frequency(const size_t i)
+    {
+      return voyx::vector<T>(frequencies().data() + i * spectrum_stride, spectrum_bins);
+    }
+
+    const voyx::vector<T> frequency(const size_t i) const
+    {
+      return voyx::vector<T>(frequencies().data() + i * spectrum_stride, spectrum_bins);
+    }
+
+    /**
+     * Returns all magnitude rows including the padding.
+     **/
+    voyx::matrix<T> magnitudes()
+    {
+      return voyx::matrix<T>(spectrum_data.get(), spectrum_size * spectrum_stride, spectrum_stride);
+    }
+
+    const voyx::matrix<T> magnitudes() const
+    {
+      return voyx::matrix<T>(spectrum_data.get(), spectrum_size * spectrum_stride, spectrum_stride);
+    }
+
+    /**
+     * Returns all frequency rows including the padding.
+     **/
+    voyx::matrix<T> frequencies()
+    {
+      return voyx::matrix<T>(spectrum_data.get() + spectrum_size * spectrum_stride, spectrum_size * spectrum_stride, spectrum_stride);
+    }
+
+    const voyx::matrix<T> frequencies() const
+    {
+      return voyx::matrix<T>(spectrum_data.get() + spectrum_size * spectrum_stride, spectrum_size * spectrum_stride, spectrum_stride);
+    }
+
+  private:
+
+    struct deleter
+    {
+      void operator()(T* data) const
+      {
+        ::operator delete[](data, std::align_val_t(alignment));
+      }
+    };
+
+    size_t spectrum_size = 0;   // rows
+    size_t spectrum_bins = 0;   // cols
+    size_t spectrum_stride = 0; // padded cols
+
+    std::unique_ptr<T[], deleter> spectrum_data;
+
+  };
+}
@@ -8,28 +8,50 @@ template<> struct WellKnownTimerDuration<std::chrono::milliseconds> : std::true_
 template<> struct WellKnownTimerDuration<std::chrono::microseconds> : std::true_type {};
 template<> struct WellKnownTimerDuration<std::chrono::nanoseconds> : std::true_type {};
 
+/**
+ * Records durations into a fixed log-linear histogram of atomic counters,
+ * so that tic and toc never allocate and str can be called concurrently
+ * from another thread. Each power of two is divided into 16 linear bins,
+ * which limits the relative percentile error to about 6%.
+ *
+ * Durations exceeding the optional budget, e.g. the frame duration,
+ * are counted as deadline misses.
+ **/
 template<typename T>
 class Timer
 {
 
 public:
 
-  Timer(const size_t capacity = 100000)
+  Timer(const std::chrono::duration<double> budget = std::chrono::duration<double>::zero()) :
+    budget(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(budget).count()))
   {
     static_assert(WellKnownTimerDuration<T>::value, "s,ms,us,ns");
 
-    data.reserve(capacity);
+    cls();
   }
 
-  Timer(const Timer& other)
+  Timer(const Timer& other) :
+    budget(other.budget)
   {
-    data.reserve(other.data.capacity());
-    data.assign(other.data.begin(), other.data.end());
+    for (size_t i = 0; i < bins; ++i)
+    {
+      histogram[i] = other.histogram[i].load(std::memory_order_relaxed);
+    }
+
+    misses = other.misses.load(std::memory_order_relaxed);
+    maximum = other.maximum.load(std::memory_order_relaxed);
   }
 
   void cls()
   {
-    data.clear();
+    for (auto& count : histogram)
+    {
+      count.store(0, std::memory_order_relaxed);
+    }
+
+    misses.store(0, std::memory_order_relaxed);
+    maximum.store(0, std::memory_order_relaxed);
   }
 
   void tic()
@@ -39,13 +61,94 @@ public:
 
   void toc()
   {
-    const std::chrono::steady_clock::duration duration = std::chrono::steady_clock::now() - timestamp;
-    const double value = std::chrono::duration_cast<T>(duration * 1e+3).count() * 1e-3;
+    add(std::chrono::steady_clock::now() - timestamp);
+  }
+
+  /**
+   * Records the specified duration, may be called concurrently.
+   **/
+  void add(const std::chrono::steady_clock::duration duration)
+  {
+    const uint64_t value = static_cast<uint64_t>(std::max<std::chrono::nanoseconds::rep>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(), 0));
+
+    histogram[bin(value)].fetch_add(1, std::memory_order_relaxed);
+
+    if (budget && value > budget)
+    {
+      misses.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t max = maximum.load(std::memory_order_relaxed);
+
+    while (value > max && !maximum.compare_exchange_weak(max, value, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  /**
+   * Returns the number of recorded durations.
+   **/
+  uint64_t size() const
+  {
+    uint64_t n = 0;
+
+    for (const auto& count : histogram)
+    {
+      n += count.load(std::memory_order_relaxed);
+    }
+
+    return n;
+  }
+
+  /**
+   * Returns the specified percentile, e.g. 0.99, in units of T.
+   **/
+  double percentile(const double p) const
+  {
+    std::array<uint64_t, bins> counts;
+
+    for (size_t i = 0; i < bins; ++i)
+    {
+      counts[i] = histogram[i].load(std::memory_order_relaxed);
+    }
+
+    const uint64_t n = std::accumulate(counts.begin(), counts.end(), uint64_t(0));
+    const uint64_t rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(p * n)), 1);
+    const double max = static_cast<double>(maximum.load(std::memory_order_relaxed));
+
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < bins; ++i)
+    {
+      sum += counts[i];
+
+      if (sum >= rank)
+      {
+        return std::min(value(i), max) * scale();
+      }
+    }
 
-    data.push_back(value);
+    return 0;
   }
 
-  std::string str()
+  /**
+   * Returns the maximum duration in units of T.
+   **/
+  double max() const
+  {
+    return maximum.load(std::memory_order_relaxed) * scale();
+  }
+
+  /**
+   * Returns the number of durations exceeding the budget.
+   **/
+  uint64_t miss() const
+  {
+    return misses.load(std::memory_order_relaxed);
+  }
+
+  std::string str() const
   {
     const std::map<intmax_t, std::string> units =
     {
@@ -57,22 +160,69 @@ public:
 
     const std::string unit = units.at(T::period::num * T::period::den);
 
-    const double sum = std::accumulate(data.begin(), data.end(), 0.0);
-    const double sumsum = std::inner_product(data.begin(), data.end(), data.begin(), 0.0);
-
-    const double mean = sum / data.size();
-    const double stdev = std::sqrt(sumsum / data.size() - mean * mean);
-
     std::ostringstream result;
     result.precision(3);
-    result << mean << " ± " << stdev << " " << unit << " n=" << data.size();
+    result << "p50 " << percentile(0.5)
+           << " p90 " << percentile(0.9)
+           << " p99 " << percentile(0.99)
+           << " p99.9 " << percentile(0.999)
+           << " max " << max()
+           << " " << unit << " n=" << size();
+
+    if (budget)
+    {
+      result << " miss=" << miss();
+    }
 
     return result.str();
   }
 
 private:
 
+  static const size_t linear = 16;
+  static const size_t octaves = 64 - 4 + 1;
+  static const size_t bins = octaves * linear;
+
+  const uint64_t budget;
+
   std::chrono::time_point<std::chrono::steady_clock> timestamp;
-  std::vector<double> data;
+
+  std::array<std::atomic<uint64_t>, bins> histogram;
+  std::atomic<uint64_t> misses;
+  std::atomic<uint64_t> maximum;
+
+  static double scale()
+  {
+    return 1e-9 * T::period::den / T::period::num;
+  }
+
+  static size_t bin(const uint64_t value)
+  {
+    if (value < linear)
+    {
+      return static_cast<size_t>(value);
+    }
+
+    const size_t msb = static_cast<size_t>(std::bit_width(value)) - 1;
+    const size_t sub = static_cast<size_t>(value >> (msb - 4)) & (linear - 1);
+
+    return (msb - 3) * linear + sub;
+  }
+
+  static double value(const size_t index)
+  {
+    const size_t octave = index / linear;
+    const size_t sub = index % linear;
+
+    if (!octave)
+    {
+      return static_cast<double>(sub);
+    }
+
+    const double width = std::ldexp(1.0, static_cast<int>(octave) - 1);
+
+    // center of the bin
+    return (linear + sub) * width + width / 2;
+  }
 
 };
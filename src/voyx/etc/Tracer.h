@@ -0,0 +1,246 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/etc/Format.h>
+#include <voyx/etc/Logger.h>
+
+#define voyxtracejoin(a, b) a##b
+#define voyxtraceconcat(a, b) voyxtracejoin(a, b)
+
+#define voyxtrace(name) \
+  const voyx::tracer::scope voyxtraceconcat(voyxtracescope, __LINE__)(name);
+
+namespace voyx
+{
+  /**
+   * Records named time spans per thread into a preallocated ring
+   * and dumps them in the Chrome trace event format, which can
+   * be inspected in chrome://tracing or ui.perfetto.dev.
+   *
+   * Recording is disabled until start is called, in which case
+   * the voyxtrace("name") macro costs a single atomic load.
+   * The name must be a string literal, since only the pointer
+   * is stored in the ring.
+   *
+   * Each slot carries the sequence number of its last complete write,
+   * so that the dump skips slots which are being overwritten
+   * by a thread that wrapped around the ring in the meantime.
+   **/
+  struct tracer
+  {
+    struct scope
+    {
+      scope(const char* name) :
+        name(name),
+        timestamp(enabled() ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point())
+      {
+      }
+
+      ~scope()
+      {
+        if (enabled())
+        {
+          add(name, timestamp, std::chrono::steady_clock::now());
+        }
+      }
+
+      const char* name;
+      const std::chrono::steady_clock::time_point timestamp;
+    };
+
+    static bool enabled()
+    {
+      return ring().enabled.load(std::memory_order_relaxed);
+    }
+
+    static void start(const size_t capacity = 1 << 20)
+    {
+      auto& ring = tracer::ring();
+
+      ring.enabled = false;
+      ring.events = std::vector<Event>(std::max<size_t>(capacity, 1));
+      ring.cursor = 0;
+      ring.origin = std::chrono::steady_clock::now();
+      ring.enabled = true;
+    }
+
+    static void stop()
+    {
+      ring().enabled = false;
+    }
+
+    /**
+     * Names the calling thread in the trace, e.g. at the beginning
+     * of a thread function or in the first audio callback.
+     **/
+    static void name(const char* name)
+    {
+      const size_t id = thread();
+
+      if (id < ring().names.size())
+      {
+        ring().names[id] = name;
+      }
+    }
+
+    static void add(const char* name, const std::chrono::steady_clock::time_point begin, const std::chrono::steady_clock::time_point end)
+    {
+      auto& ring = tracer::ring();
+
+      const size_t ticket = ring.cursor.fetch_add(1, std::memory_order_relaxed);
+
+      auto& event = ring.events[ticket % ring.events.size()];
+
+      // invalidate the slot until all fields are written
+      event.sequence.store(0, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+
+      event.name.store(name, std::memory_order_relaxed);
+      event.thread.store(thread(), std::memory_order_relaxed);
+      event.begin.store(begin.time_since_epoch().count(), std::memory_order_relaxed);
+      event.end.store(end.time_since_epoch().count(), std::memory_order_relaxed);
+
+      event.sequence.store(ticket + 1, std::memory_order_release);
+    }
+
+    static void dump(const std::string& path)
+    {
+      stop();
+
+      auto& ring = tracer::ring();
+
+      std::ofstream file(path);
+
+      if (!file.is_open())
+      {
+        throw std::runtime_error(
+          $("Unable to open \"{0}\"!", path));
+      }
+
+      auto micros = [&](const std::chrono::steady_clock::rep timestamp)
+      {
+        const auto duration = std::chrono::steady_clock::duration(timestamp);
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::time_point(duration) - ring.origin).count();
+      };
+
+      const size_t cursor = ring.cursor.load();
+      const size_t first = (cursor > ring.events.size()) ? cursor - ring.events.size() : 0;
+
+      file << "{\"traceEvents\":[" << std::endl;
+
+      bool comma = false;
+
+      for (size_t i = 0; i < ring.names.size(); ++i)
+      {
+        if (ring.names[i] == nullptr)
+        {
+          continue;
+        }
+
+        file << (comma ? ",\n" : "")
+             << $("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{0},\"args\":{{\"name\":\"{1}\"}}}}",
+                  i, escape(ring.names[i]));
+
+        comma = true;
+      }
+
+      size_t size = 0;
+
+      for (size_t ticket = first; ticket < cursor; ++ticket)
+      {
+        const auto& event = ring.events[ticket % ring.events.size()];
+
+        const size_t sequence = event.sequence.load(std::memory_order_acquire);
+
+        const char* name = event.name.load(std::memory_order_relaxed);
+        const size_t thread = event.thread.load(std::memory_order_relaxed);
+        const auto begin = event.begin.load(std::memory_order_relaxed);
+        const auto end = event.end.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // skip incomplete or already overwritten slots
+        if (sequence != ticket + 1 || event.sequence.load(std::memory_order_relaxed) != sequence)
+        {
+          continue;
+        }
+
+        file << (comma ? ",\n" : "")
+             << $("{{\"name\":\"{0}\",\"ph\":\"X\",\"pid\":0,\"tid\":{1},\"ts\":{2:.3f},\"dur\":{3:.3f}}}",
+                  escape(name), thread, micros(begin), micros(end) - micros(begin));
+
+        comma = true;
+        ++size;
+      }
+
+      file << std::endl << "]}" << std::endl;
+
+      LOG(INFO) << $("Written {0} trace events to \"{1}\".", size, path);
+    }
+
+  private:
+
+    struct Event
+    {
+      std::atomic<size_t> sequence = 0;
+      std::atomic<const char*> name = nullptr;
+      std::atomic<size_t> thread = 0;
+      std::atomic<std::chrono::steady_clock::rep> begin = 0;
+      std::atomic<std::chrono::steady_clock::rep> end = 0;
+    };
+
+    struct Ring
+    {
+      std::vector<Event> events;
+      std::array<const char*, 64> names = {};
+      std::atomic<size_t> cursor = 0;
+      std::atomic<bool> enabled = false;
+      std::chrono::steady_clock::time_point origin;
+    };
+
+    static Ring& ring()
+    {
+      static Ring ring;
+      return ring;
+    }
+
+    /**
+     * Escapes the specified name as a JSON string.
+     **/
+    static std::string escape(const char* name)
+    {
+      std::string result;
+
+      for (const char* c = name; *c; ++c)
+      {
+        switch (*c)
+        {
+          case '"':
+            result += "\\\"";
+            break;
+          case '\\':
+            result += "\\\\";
+            break;
+          default:
+            if (static_cast<unsigned char>(*c) < 0x20)
+            {
+              result += $("\\u{0:04x}", static_cast<int>(*c));
+            }
+            else
+            {
+              result += *c;
+            }
+        }
+      }
+
+      return result;
+    }
+
+    static size_t thread()
+    {
+      static std::atomic<size_t> threads = 0;
+      static thread_local const size_t id = threads++;
+      return id;
+    }
+  };
+}
@@ -0,0 +1,210 @@
+#include <voyx/etc/Vocoding.h>
+
+#include <voyx/etc/SIMD.h>
+
+namespace
+{
+  template<typename T>
+  struct PiHalf;
+
+  // pi/2 split into a high and low part for accurate argument reduction
+
+  template<>
+  struct PiHalf<float>
+  {
+    static constexpr float hi = 1.57079637050628662109375f;
+    static constexpr float lo = -4.37113900018624283e-8f;
+  };
+
+  template<>
+  struct PiHalf<double>
+  {
+    static constexpr double hi = 1.57079632679489655800;
+    static constexpr double lo = 6.12323399573676603587e-17;
+  };
+
+  /**
+   * Branchless variant of the Girones arctangent approximation
+   * in Vocoder::atan2 with the same result interval from 0 to 2pi.
+   **/
+  template<typename T>
+  inline T atan2(const T y, const T x)
+  {
+    const T a = T(0.596227);
+    const T b = std::abs(a * y * x);
+    const T c = b + y * y;
+    const T d = b + x * x;
+    const T e = c / std::max(c + d, std::numeric_limits<T>::min());
+
+    const T ys = (y < 0) ? T(1) : T(0);
+    const T xs = (x < 0) ? T(1) : T(0);
+
+    const T q = ys * (1 - xs) * 4 + xs * 2;
+    const T s = 1 - 2 * (ys + xs - 2 * ys * xs);
+
+    return (q + s * e) * T(1.57079632679489661923);
+  }
+
+  template<typename T>
+  inline T wrap(const T phase)
+  {
+    const T pi = T(2) * T(M_PI);
+
+    return phase - pi * std::floor(phase / pi + T(0.5));
+  }
+
+  template<typename T>
+  inline void sincos(const T phase, T& sin, T& cos)
+  {
+    const T k = std::floor(phase * T(0.63661977236758134308) + T(0.5));
+    const T q = k - 4 * std::floor(k * T(0.25));
+
+    const T x = (phase - k * PiHalf<T>::hi) - k * PiHalf<T>::lo;
+    const T x2 = x * x;
+
+    const T s = x * (T(1) + x2 * (T(-1.0 / 6) + x2 * (T(1.0 / 120) + x2 * (T(-1.0 / 5040) +
+                x2 * (T(1.0 / 362880) + x2 * T(-1.0 / 39916800))))));
+
+    const T c = T(1) + x2 * (T(-1.0 / 2) + x2 * (T(1.0 / 24) + x2 * (T(-1.0 / 720) +
+                x2 * (T(1.0 / 40320) + x2 * (T(-1.0 / 3628800) + x2 * T(1.0 / 479001600))))));
+
+    const bool odd = (q == 1) || (q == 3);
+
+    const T a = odd ? c : s;
+    const T b = odd ? s : c;
+
+    sin = (q >= 2) ? -a : a;
+    cos = (q == 1 || q == 2) ? -b : b;
+  }
+
+  template<typename T>
+  inline void encode(T* VOYXRESTRICT dft, T* VOYXRESTRICT buffer, const size_t size, const T freqinc, const T phaseinc)
+  {
+    T index = 0;
+
+    for (size_t i = 0; i < size; ++i, ++index)
+    {
+      const T real = dft[i * 2];
+      const T imag = dft[i * 2 + 1];
+
+      const T phase = atan2(imag, real);
+      const T delta = phase - buffer[i];
+
+      buffer[i] = phase;
+
+      const T j = wrap(delta - index * phaseinc) / phaseinc;
+
+      dft[i * 2] = std::sqrt(real * real + imag * imag);
+      dft[i * 2 + 1] = (index + j) * freqinc;
+    }
+  }
+
+  template<typename T>
+  inline void decode(T* VOYXRESTRICT dft, T* VOYXRESTRICT buffer, const T* VOYXRESTRICT timeshift, const size_t size, const T freqinc, const T phaseinc)
+  {
+    T index = 0;
+
+    for (size_t i = 0; i < size; ++i, ++index)
+    {
+      const T magnitude = dft[i * 2];
+      const T frequency = dft[i * 2 + 1];
+
+      const T j = (frequency - index * freqinc) / freqinc;
+      const T delta = (index + j) * phaseinc;
+
+      buffer[i] = wrap(buffer[i] + delta);
+
+      T sin, cos;
+
+      sincos(buffer[i] - timeshift[i], sin, cos);
+
+      dft[i * 2] = magnitude * cos;
+      dft[i * 2 + 1] = magnitude * sin;
+    }
+  }
+
+  template<typename T>
+  inline void encode(const T* VOYXRESTRICT dft, T* VOYXRESTRICT magnitude, T* VOYXRESTRICT frequency, T* VOYXRESTRICT buffer,
+                     const size_t size, const T freqinc, const T phaseinc)
+  {
+    T index = 0;
+
+    for (size_t i = 0; i < size; ++i, ++index)
+    {
+      const T real = dft[i * 2];
+      const T imag = dft[i * 2 + 1];
+
+      const T phase = atan2(imag, real);
+      const T delta = phase - buffer[i];
+
+      buffer[i] = phase;
+
+      const T j = wrap(delta - index * phaseinc) / phaseinc;
+
+      magnitude[i] = std::sqrt(real * real + imag * imag);
+      frequency[i] = (index + j) * freqinc;
+    }
+  }
+
+  template<typename T>
+  inline void decode(const T* VOYXRESTRICT magnitude, const T* VOYXRESTRICT frequency, T* VOYXRESTRICT dft, T* VOYXRESTRICT buffer,
+                     const T* VOYXRESTRICT timeshift, const size_t size, const T freqinc, const T phaseinc)
+  {
+    T index = 0;
+
+    for (size_t i = 0; i < size; ++i, ++index)
+    {
+      const T j = (frequency[i] - index * freqinc) / freqinc;
+      const T delta = (index + j) * phaseinc;
+
+      buffer[i] = wrap(buffer[i] + delta);
+
+      T sin, cos;
+
+      sincos(buffer[i] - timeshift[i], sin, cos);
+
+      dft[i * 2] = magnitude[i] * cos;
+      dft[i * 2 + 1] = magnitude[i] * sin;
+    }
+  }
+}
+
+VOYXCLONES void voyx::vocoding::encode(std::complex<float>* dft, float* buffer, const size_t size, const float freqinc, const float phaseinc)
+{
+  ::encode(reinterpret_cast<float*>(dft), buffer, size, freqinc, phaseinc);
+}
+
+VOYXCLONES void voyx::vocoding::encode(std::complex<double>* dft, double* buffer, const size_t size, const double freqinc, const double phaseinc)
+{
+  ::encode(reinterpret_cast<double*>(dft), buffer, size, freqinc, phaseinc);
+}
+
+VOYXCLONES void voyx::vocoding::decode(std::complex<float>* dft, float* buffer, const float* timeshift, const size_t size, const float freqinc, const float phaseinc)
+{
+  ::decode(reinterpret_cast<float*>(dft), buffer, timeshift, size, freqinc, phaseinc);
+}
+
+VOYXCLONES void voyx::vocoding::decode(std::complex<double>* dft, double* buffer, const double* timeshift, const size_t size, const double freqinc, const double phaseinc)
+{
+  ::decode(reinterpret_cast<double*>(dft), buffer, timeshift, size, freqinc, phaseinc);
+}
+
+VOYXCLONES void voyx::vocoding::encode(const std::complex<float>* dft, float* magnitude, float* frequency, float* buffer, const size_t size, const float freqinc, const float phaseinc)
+{
+  ::encode(reinterpret_cast<const float*>(dft), magnitude, frequency, buffer, size, freqinc, phaseinc);
+}
+
+VOYXCLONES void voyx::vocoding::encode(const std::complex<double>* dft, double* magnitude, double* frequency, double* buffer, const size_t size, const double freqinc, const double phaseinc)
+{
+  ::encode(reinterpret_cast<const double*>(dft), magnitude, frequency, buffer, size, freqinc, phaseinc);
+}
+
+VOYXCLONES void voyx::vocoding::decode(const float* magnitude, const float* frequency, std::complex<float>* dft, float* buffer, const float* timeshift, const size_t size, const float freqinc, const float phaseinc)
+{
+  ::decode(magnitude, frequency, reinterpret_cast<float*>(dft), buffer, timeshift, size, freqinc, phaseinc);
+}
+
+VOYXCLONES void voyx::vocoding::decode(const double* magnitude, const double* frequency, std::complex<double>* dft, double* buffer, const double* timeshift, const size_t size, const double freqinc, const double phaseinc)
+{
+  ::decode(magnitude, frequency, reinterpret_cast<double*>(dft), buffer, timeshift, size, freqinc, phaseinc);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <voyx/Header.h>
+
+namespace voyx
+{
+  /**
+   * Runtime dispatched, branchless phase vocoder kernels,
+   * which are equivalent to the scalar Vocoder::encode and Vocoder::decode.
+   *
+   * The encoder uses the same full quadrant arctangent approximation,
+   * the decoder a quadrant reduced polynomial sine and cosine approximation
+   * instead of std::polar with an absolute error below 1e-11.
+   **/
+  namespace vocoding
+  {
+    void encode(std::complex<float>* dft, float* buffer, const size_t size, const float freqinc, const float phaseinc);
+    void encode(std::complex<double>* dft, double* buffer, const size_t size, const double freqinc, const double phaseinc);
+
+    void decode(std::complex<float>* dft, float* buffer, const float* timeshift, const size_t size, const float freqinc, const float phaseinc);
+    void decode(std::complex<double>* dft, double* buffer, const double* timeshift, const size_t size, const double freqinc, const double phaseinc);
+
+    /**
+     * Variants writing or reading separate magnitude and frequency arrays
+     * instead of overwriting the complex input with interleaved values.
+     **/
+
+    void encode(const std::complex<float>* dft, float* magnitude, float* frequency, float* buffer, const size_t size, const float freqinc, const float phaseinc);
+    void encode(const std::complex<double>* dft, double* magnitude, double* frequency, double* buffer, const size_t size, const double freqinc, const double phaseinc);
+
+    void decode(const float* magnitude, const float* frequency, std::complex<float>* dft, float* buffer, const float* timeshift, const size_t size, const float freqinc, const float phaseinc);
+    void decode(const double* magnitude, const double* frequency, std::complex<double>* dft, double* buffer, const double* timeshift, const size_t size, const double freqinc, const double phaseinc);
+  }
+}
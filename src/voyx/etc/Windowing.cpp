@@ -0,0 +1,54 @@
+#include <voyx/etc/Windowing.h>
+
+#include <voyx/etc/SIMD.h>
+
+namespace
+{
+  template<typename X, typename W, typename Y>
+  inline void multiply(const X* VOYXRESTRICT x, const W* VOYXRESTRICT w, Y* VOYXRESTRICT y, const size_t n)
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      y[i] = static_cast<Y>(x[i] * w[i]);
+    }
+  }
+
+  template<typename X, typename W, typename Y>
+  inline void accumulate(const X* VOYXRESTRICT x, const W* VOYXRESTRICT w, Y* VOYXRESTRICT y, const size_t n)
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      y[i] += static_cast<Y>(x[i] * w[i]);
+    }
+  }
+}
+
+VOYXCLONES void voyx::windowing::multiply(const float* x, const float* w, float* y, const size_t n)
+{
+  ::multiply(x, w, y, n);
+}
+
+VOYXCLONES void voyx::windowing::multiply(const float* x, const float* w, double* y, const size_t n)
+{
+  ::multiply(x, w, y, n);
+}
+
+VOYXCLONES void voyx::windowing::multiply(const double* x, const double* w, double* y, const size_t n)
+{
+  ::multiply(x, w, y, n);
+}
+
+VOYXCLONES void voyx::windowing::accumulate(const float* x, const float* w, float* y, const size_t n)
+{
+  ::accumulate(x, w, y, n);
+}
+
+VOYXCLONES void voyx::windowing::accumulate(const double* x, const float* w, float* y, const size_t n)
+{
+  ::accumulate(x, w, y, n);
+}
+
+VOYXCLONES void voyx::windowing::accumulate(const double* x, const double* w, double* y, const size_t n)
+{
+  ::accumulate(x, w, y, n);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <voyx/Header.h>
+
+namespace voyx
+{
+  /**
+   * Runtime dispatched window multiply and overlap-add kernels of the STFT.
+   * Mixed precision overloads fuse the type conversion into the loop.
+   **/
+  namespace windowing
+  {
+    /**
+     * Computes y[i] = x[i] * w[i].
+     **/
+    void multiply(const float* x, const float* w, float* y, const size_t n);
+    void multiply(const float* x, const float* w, double* y, const size_t n);
+    void multiply(const double* x, const double* w, double* y, const size_t n);
+
+    /**
+     * Computes y[i] += x[i] * w[i].
+     **/
+    void accumulate(const float* x, const float* w, float* y, const size_t n);
+    void accumulate(const double* x, const float* w, float* y, const size_t n);
+    void accumulate(const double* x, const double* w, double* y, const size_t n);
+  }
+}
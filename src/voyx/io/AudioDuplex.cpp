@@ -0,0 +1,259 @@
+#include <voyx/io/AudioDuplex.h>
+
+#include <voyx/Source.h>
+#include <voyx/etc/Allocation.h>
+#include <voyx/etc/Tracer.h>
+
+AudioDuplex::AudioDuplex(const std::string& input, const std::string& output, double samplerate, size_t framesize) :
+  Source(samplerate, framesize, 0),
+  audio_input_device_name(input),
+  audio_output_device_name(output),
+  audio_frame_index(0),
+  audio_stream_overflows(0),
+  audio_stream_underflows(0)
+{
+}
+
+void AudioDuplex::open()
+{
+  close();
+
+  if (!audio.getDeviceCount())
+  {
+    throw std::runtime_error(
+      "No audio devices available!");
+  }
+
+  const uint32_t input_id = find(audio_input_device_name, true);
+  const uint32_t output_id = find(audio_output_device_name, false);
+
+  const RtAudio::DeviceInfo input_device = audio.getDeviceInfo(input_id);
+  const RtAudio::DeviceInfo output_device = audio.getDeviceInfo(output_id);
+
+  RtAudio::StreamParameters input_stream_parameters;
+  input_stream_parameters.deviceId = input_id;
+  input_stream_parameters.nChannels = 1;
+  input_stream_parameters.firstChannel = 0;
+
+  RtAudio::StreamParameters output_stream_parameters;
+  output_stream_parameters.deviceId = output_id;
+  output_stream_parameters.nChannels = 1;
+  output_stream_parameters.firstChannel = 0;
+
+  const RtAudioFormat stream_format = (typeid(sample_t) == typeid(float)) ? RTAUDIO_FLOAT32 : RTAUDIO_FLOAT64;
+  uint32_t stream_samplerate = output_device.preferredSampleRate;
+  uint32_t stream_framesize = static_cast<uint32_t>(framesize());
+
+  const bool native_input_samplerate = std::find(
+    input_device.sampleRates.begin(), input_device.sampleRates.end(),
+    static_cast<uint32_t>(samplerate())) != input_device.sampleRates.end();
+
+  const bool native_output_samplerate = std::find(
+    output_device.sampleRates.begin(), output_device.sampleRates.end(),
+    static_cast<uint32_t>(samplerate())) != output_device.sampleRates.end();
+
+  if (native_input_samplerate && native_output_samplerate)
+  {
+    stream_samplerate = static_cast<uint32_t>(samplerate());
+  }
+
+  audio_input_samplerate_converter = { stream_samplerate, samplerate() };
+  audio_output_samplerate_converter = { samplerate(), stream_samplerate };
+
+  stream_framesize /= audio_input_samplerate_converter.quotient();
+
+  if (stream_samplerate != samplerate())
+  {
+    LOG(INFO) << $("Opening audio duplex stream with sr={0} and fs={1}.",
+                   stream_samplerate, stream_framesize);
+  }
+
+  audio_input_frame.resize(framesize());
+  audio_output_frame.resize(framesize());
+
+  RtAudio::StreamOptions stream_options;
+  stream_options.flags = RTAUDIO_MINIMIZE_LATENCY | RTAUDIO_SCHEDULE_REALTIME;
+
+  audio.openStream(
+    &output_stream_parameters,
+    &input_stream_parameters,
+    stream_format,
+    stream_samplerate,
+    &stream_framesize,
+    &AudioDuplex::callback,
+    this,
+    &stream_options,
+    &AudioDuplex::error);
+
+  if (stream_framesize * audio_input_samplerate_converter.quotient() != framesize())
+  {
+    throw std::runtime_error(
+      $("Unexpected audio duplex stream frame size {0} * {2} != {1}!",
+        stream_framesize, framesize(), audio_input_samplerate_converter.quotient()));
+  }
+}
+
+void AudioDuplex::close()
+{
+  if (audio.isStreamRunning())
+  {
+    audio.stopStream();
+  }
+
+  if (audio.isStreamOpen())
+  {
+    audio.closeStream();
+  }
+}
+
+void AudioDuplex::start()
+{
+  if (!audio.isStreamOpen())
+  {
+    return;
+  }
+
+  if (audio.isStreamRunning())
+  {
+    audio.stopStream();
+  }
+
+  audio_frame_index = 0;
+  audio_stream_overflows = 0;
+  audio_stream_underflows = 0;
+}
+
+void AudioDuplex::stop()
+{
+  if (!audio.isStreamOpen())
+  {
+    return;
+  }
+
+  if (!audio.isStreamRunning())
+  {
+    return;
+  }
+
+  audio.stopStream();
+
+  if (audio_stream_overflows || audio_stream_underflows)
+  {
+    LOG(WARNING) << $("Audio duplex stream had {0} overflows and {1} underflows in {2} frames!",
+                      audio_stream_overflows.load(), audio_stream_underflows.load(), audio_frame_index);
+  }
+}
+
+bool AudioDuplex::read(const size_t index, std::function<void(const voyx::vector<sample_t> frame)> callback)
+{
+  return false;
+}
+
+bool AudioDuplex::duplex() const
+{
+  return true;
+}
+
+void AudioDuplex::process(std::function<void(const size_t index, const voyx::vector<sample_t> input, voyx::vector<sample_t> output)> callback)
+{
+  if (!audio.isStreamOpen())
+  {
+    return;
+  }
+
+  if (audio.isStreamRunning())
+  {
+    audio.stopStream();
+  }
+
+  // the callback is only replaced while the stream is stopped
+  audio_frame_callback = callback;
+
+  audio.startStream();
+}
+
+uint32_t AudioDuplex::find(const std::string& name, const bool input)
+{
+  if (name.empty())
+  {
+    return input ? audio.getDefaultInputDevice() : audio.getDefaultOutputDevice();
+  }
+
+  const uint32_t devices = audio.getDeviceCount();
+
+  for (uint32_t i = 0; i < devices; ++i)
+  {
+    const RtAudio::DeviceInfo device = audio.getDeviceInfo(i);
+
+    if (!device.probed)
+    {
+      continue;
+    }
+
+    if ((input ? device.inputChannels : device.outputChannels) < 1)
+    {
+      continue;
+    }
+
+    if (!$$::imatch(device.name, ".*" + name + ".*"))
+    {
+      continue;
+    }
+
+    return i;
+  }
+
+  throw std::runtime_error(
+    $("Audio {0} \"{1}\" not found!",
+      input ? "source" : "sink", name));
+}
+
+int AudioDuplex::callback(void* output_frame_data, void* input_frame_data, uint32_t framesize, double timestamp, RtAudioStreamStatus status, void* $this)
+{
+  // name the callback thread only once
+  static thread_local bool named = false;
+
+  if (!named)
+  {
+    voyx::tracer::name("AudioDuplex");
+    named = true;
+  }
+
+  voyxtrace("AudioDuplex::callback");
+  voyxrealtime("AudioDuplex::callback");
+
+  auto& self = *static_cast<AudioDuplex*>($this);
+
+  voyx::vector<sample_t> input = { self.audio_input_frame.data(), self.audio_input_frame.size() };
+  voyx::vector<sample_t> output = { self.audio_output_frame.data(), self.audio_output_frame.size() };
+
+  self.audio_input_samplerate_converter({ static_cast<sample_t*>(input_frame_data), framesize }, input);
+
+  if (self.audio_frame_callback)
+  {
+    self.audio_frame_callback(self.audio_frame_index++, input, output);
+  }
+  else
+  {
+    output = sample_t(0);
+  }
+
+  self.audio_output_samplerate_converter(output, { static_cast<sample_t*>(output_frame_data), framesize });
+
+  if (status & RTAUDIO_INPUT_OVERFLOW)
+  {
+    ++self.audio_stream_overflows;
+  }
+
+  if (status & RTAUDIO_OUTPUT_UNDERFLOW)
+  {
+    ++self.audio_stream_underflows;
+  }
+
+  return 0;
+}
+
+void AudioDuplex::error(RtAudioError::Type type, const std::string& error)
+{
+  LOG(ERROR) << "Audio duplex stream error: " << error;
+}
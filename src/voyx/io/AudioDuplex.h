@@ -0,0 +1,60 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/alg/SRC.h>
+#include <voyx/io/Source.h>
+
+#include <RtAudio.h>
+
+/**
+ * Opens a single full-duplex stream on the input and output audio device
+ * and invokes the pipeline directly in the audio callback, so there are
+ * no intermediate fifos and no additional thread wakeups per frame.
+ *
+ * All buffers are preallocated in open, the callback itself neither
+ * allocates nor locks. Stream errors are counted in the callback
+ * and reported when the stream is stopped.
+ **/
+class AudioDuplex : public Source<sample_t>
+{
+
+public:
+
+  AudioDuplex(const std::string& input, const std::string& output, double samplerate, size_t framesize);
+
+  void open() override;
+  void close() override;
+
+  void start() override;
+  void stop() override;
+
+  bool read(const size_t index, std::function<void(const voyx::vector<sample_t> frame)> callback) override;
+
+  bool duplex() const override;
+  void process(std::function<void(const size_t index, const voyx::vector<sample_t> input, voyx::vector<sample_t> output)> callback) override;
+
+private:
+
+  const std::string audio_input_device_name;
+  const std::string audio_output_device_name;
+
+  SRC<sample_t> audio_input_samplerate_converter;
+  SRC<sample_t> audio_output_samplerate_converter;
+
+  std::vector<sample_t> audio_input_frame;
+  std::vector<sample_t> audio_output_frame;
+
+  std::function<void(const size_t index, const voyx::vector<sample_t> input, voyx::vector<sample_t> output)> audio_frame_callback;
+  size_t audio_frame_index;
+
+  std::atomic<size_t> audio_stream_overflows;
+  std::atomic<size_t> audio_stream_underflows;
+
+  RtAudio audio;
+
+  uint32_t find(const std::string& name, const bool input);
+
+  static int callback(void* output_frame_data, void* input_frame_data, uint32_t framesize, double timestamp, RtAudioStreamStatus status, void* $this);
+  static void error(RtAudioError::Type type, const std::string& error);
+
+};
@@ -1,6 +1,8 @@
 #include <voyx/io/AudioSink.h>
 
 #include <voyx/Source.h>
+#include <voyx/etc/Allocation.h>
+#include <voyx/etc/Tracer.h>
 
 AudioSink::AudioSink(const std::string& name, double samplerate, size_t framesize, size_t buffersize) :
   Sink(samplerate, framesize, buffersize),
@@ -190,11 +192,25 @@ bool AudioSink::write(const size_t index, const voyx::vector<sample_t> frame)
 
 bool AudioSink::sync()
 {
+  voyxtrace("AudioSink::sync");
+
   return audio_sync_semaphore.try_acquire_for(timeout());
 }
 
 int AudioSink::callback(void* output_frame_data, void* input_frame_data, uint32_t framesize, double timestamp, RtAudioStreamStatus status, void* $this)
 {
+  // name the callback thread only once
+  static thread_local bool named = false;
+
+  if (!named)
+  {
+    voyx::tracer::name("AudioSink");
+    named = true;
+  }
+
+  voyxtrace("AudioSink::callback");
+  voyxrealtime("AudioSink::callback");
+
   auto& audio_frame_buffer = static_cast<AudioSink*>($this)->audio_frame_buffer;
   auto& audio_samplerate_converter = static_cast<AudioSink*>($this)->audio_samplerate_converter;
   auto& audio_sync_semaphore = static_cast<AudioSink*>($this)->audio_sync_semaphore;
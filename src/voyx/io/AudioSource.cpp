@@ -1,6 +1,8 @@
 #include <voyx/io/AudioSource.h>
 
 #include <voyx/Source.h>
+#include <voyx/etc/Allocation.h>
+#include <voyx/etc/Tracer.h>
 
 AudioSource::AudioSource(const std::string& name, double samplerate, size_t framesize, size_t buffersize) :
   Source(samplerate, framesize, buffersize),
@@ -189,6 +191,18 @@ bool AudioSource::read(const size_t index, std::function<void(const voyx::vector
 
 int AudioSource::callback(void* output_frame_data, void* input_frame_data, uint32_t framesize, double timestamp, RtAudioStreamStatus status, void* $this)
 {
+  // name the callback thread only once
+  static thread_local bool named = false;
+
+  if (!named)
+  {
+    voyx::tracer::name("AudioSource");
+    named = true;
+  }
+
+  voyxtrace("AudioSource::callback");
+  voyxrealtime("AudioSource::callback");
+
   auto& audio_frame_buffer = static_cast<AudioSource*>($this)->audio_frame_buffer;
   auto& audio_samplerate_converter = static_cast<AudioSource*>($this)->audio_samplerate_converter;
 
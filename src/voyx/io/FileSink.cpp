@@ -34,3 +34,12 @@ bool FileSink::write(const size_t index, const voyx::vector<sample_t> frame)
 
   return true;
 }
+
+void FileSink::crop(const size_t offset, const size_t length)
+{
+  const size_t begin = std::min(offset, data.size());
+  const size_t end = std::min(offset + length, data.size());
+
+  data.erase(data.begin() + end, data.end());
+  data.erase(data.begin(), data.begin() + begin);
+}
@@ -15,6 +15,8 @@ public:
 
   bool write(const size_t index, const voyx::vector<sample_t> frame) override;
 
+  void crop(const size_t offset, const size_t length) override;
+
 private:
 
   const std::string path;
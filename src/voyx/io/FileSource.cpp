@@ -3,9 +3,10 @@
 #include <voyx/Source.h>
 #include <voyx/etc/WAV.h>
 
-FileSource::FileSource(const std::string& path, double samplerate, size_t framesize, size_t buffersize) :
+FileSource::FileSource(const std::string& path, double samplerate, size_t framesize, size_t buffersize, bool loop) :
   Source(samplerate, framesize, buffersize),
   path(path),
+  loop(loop),
   data(0),
   frame(framesize)
 {
@@ -21,15 +22,32 @@ void FileSource::close()
   data.clear();
 }
 
+size_t FileSource::length() const
+{
+  return data.size();
+}
+
 bool FileSource::read(const size_t index, std::function<void(const voyx::vector<sample_t> frame)> callback)
 {
   const size_t offset = index * frame.size();
 
-  for (size_t i = 0; i < frame.size(); ++i)
+  if (loop)
+  {
+    for (size_t i = 0; i < frame.size(); ++i)
+    {
+      const size_t j = (i + offset) % data.size();
+
+      frame[i] = data[j];
+    }
+  }
+  else
   {
-    const size_t j = (i + offset) % data.size();
+    for (size_t i = 0; i < frame.size(); ++i)
+    {
+      const size_t j = i + offset;
 
-    frame[i] = data[j];
+      frame[i] = (j < data.size()) ? data[j] : 0;
+    }
   }
 
   callback(frame);
@@ -8,16 +8,19 @@ class FileSource : public Source<sample_t>
 
 public:
 
-  FileSource(const std::string& path, double samplerate, size_t framesize, size_t buffersize);
+  FileSource(const std::string& path, double samplerate, size_t framesize, size_t buffersize, bool loop = true);
 
   void open() override;
   void close() override;
 
+  size_t length() const override;
+
   bool read(const size_t index, std::function<void(const voyx::vector<sample_t> frame)> callback) override;
 
 private:
 
   const std::string path;
+  const bool loop;
 
   std::vector<sample_t> data;
   std::vector<sample_t> frame;
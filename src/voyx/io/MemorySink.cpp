@@ -0,0 +1,35 @@
+#include <voyx/io/MemorySink.h>
+
+#include <voyx/Source.h>
+
+MemorySink::MemorySink(double samplerate, size_t framesize, size_t buffersize) :
+  Sink(samplerate, framesize, buffersize),
+  data(0)
+{
+}
+
+const std::vector<sample_t>& MemorySink::samples() const
+{
+  return data;
+}
+
+void MemorySink::start()
+{
+  data.clear();
+}
+
+bool MemorySink::write(const size_t index, const voyx::vector<sample_t> frame)
+{
+  data.insert(data.end(), frame.data(), frame.data() + frame.size());
+
+  return true;
+}
+
+void MemorySink::crop(const size_t offset, const size_t length)
+{
+  const size_t begin = std::min(offset, data.size());
+  const size_t end = std::min(offset + length, data.size());
+
+  data.erase(data.begin() + end, data.end());
+  data.erase(data.begin(), data.begin() + begin);
+}
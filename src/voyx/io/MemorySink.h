@@ -0,0 +1,25 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/io/Sink.h>
+
+class MemorySink : public Sink<sample_t>
+{
+
+public:
+
+  MemorySink(double samplerate, size_t framesize, size_t buffersize);
+
+  const std::vector<sample_t>& samples() const;
+
+  void start() override;
+
+  bool write(const size_t index, const voyx::vector<sample_t> frame) override;
+
+  void crop(const size_t offset, const size_t length) override;
+
+private:
+
+  std::vector<sample_t> data;
+
+};
@@ -0,0 +1,36 @@
+#include <voyx/io/MemorySource.h>
+
+#include <voyx/Source.h>
+
+MemorySource::MemorySource(double samplerate, size_t framesize, size_t buffersize) :
+  Source(samplerate, framesize, buffersize),
+  data(0),
+  frame(framesize)
+{
+}
+
+void MemorySource::assign(const std::span<const sample_t> samples)
+{
+  data.assign(samples.begin(), samples.end());
+}
+
+size_t MemorySource::length() const
+{
+  return data.size();
+}
+
+bool MemorySource::read(const size_t index, std::function<void(const voyx::vector<sample_t> frame)> callback)
+{
+  const size_t offset = index * frame.size();
+
+  for (size_t i = 0; i < frame.size(); ++i)
+  {
+    const size_t j = i + offset;
+
+    frame[i] = (j < data.size()) ? data[j] : 0;
+  }
+
+  callback(frame);
+
+  return true;
+}
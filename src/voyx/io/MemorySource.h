@@ -0,0 +1,24 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/io/Source.h>
+
+class MemorySource : public Source<sample_t>
+{
+
+public:
+
+  MemorySource(double samplerate, size_t framesize, size_t buffersize);
+
+  void assign(const std::span<const sample_t> samples);
+
+  size_t length() const override;
+
+  bool read(const size_t index, std::function<void(const voyx::vector<sample_t> frame)> callback) override;
+
+private:
+
+  std::vector<sample_t> data;
+  std::vector<sample_t> frame;
+
+};
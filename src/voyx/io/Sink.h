@@ -32,6 +32,11 @@ public:
   virtual bool write(const size_t index, const voyx::vector<T> frame) = 0;
   virtual bool sync() { return true; }
 
+  /**
+   * Keeps only the specified range of the written samples.
+   **/
+  virtual void crop(const size_t offset, const size_t length) {}
+
 private:
 
   const double sink_samplerate;
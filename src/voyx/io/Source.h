@@ -29,8 +29,26 @@ public:
   virtual void start() {};
   virtual void stop() {};
 
+  /**
+   * Returns the total number of samples or zero if endless.
+   **/
+  virtual size_t length() const { return 0; }
+
   virtual bool read(const size_t index, std::function<void(const voyx::vector<T> frame)> callback) = 0;
 
+  /**
+   * Returns true if the source also renders the output frames,
+   * so that each frame is processed directly in the source callback
+   * instead of being pulled by the pipeline via read.
+   **/
+  virtual bool duplex() const { return false; }
+
+  /**
+   * Starts the duplex processing with the specified callback, which
+   * receives the input frame and fills the output frame in place.
+   **/
+  virtual void process(std::function<void(const size_t index, const voyx::vector<T> input, voyx::vector<T> output)> callback) {}
+
 private:
 
   const double source_samplerate;
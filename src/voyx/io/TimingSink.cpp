@@ -0,0 +1,34 @@
+#include <voyx/io/TimingSink.h>
+
+#include <voyx/Source.h>
+
+TimingSink::TimingSink(double samplerate, size_t framesize, size_t buffersize) :
+  Sink(samplerate, framesize, buffersize),
+  intervals(std::chrono::duration<double>(framesize / samplerate))
+{
+}
+
+const Timer<std::chrono::microseconds>& TimingSink::timer() const
+{
+  return intervals;
+}
+
+void TimingSink::start()
+{
+  intervals.cls();
+  timestamp.reset();
+}
+
+bool TimingSink::write(const size_t index, const voyx::vector<sample_t> frame)
+{
+  const auto now = std::chrono::steady_clock::now();
+
+  if (timestamp)
+  {
+    intervals.add(now - timestamp.value());
+  }
+
+  timestamp = now;
+
+  return true;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <voyx/Header.h>
+#include <voyx/etc/Timer.h>
+#include <voyx/io/Sink.h>
+
+/**
+ * Discards all frames like the NullSink, but records the interval
+ * between consecutive writes, which corresponds to the per-frame
+ * processing time of an unthrottled pipeline.
+ **/
+class TimingSink : public Sink<sample_t>
+{
+
+public:
+
+  TimingSink(double samplerate, size_t framesize, size_t buffersize);
+
+  const Timer<std::chrono::microseconds>& timer() const;
+
+  void start() override;
+
+  bool write(const size_t index, const voyx::vector<sample_t> frame) override;
+
+private:
+
+  Timer<std::chrono::microseconds> intervals;
+  std::optional<std::chrono::steady_clock::time_point> timestamp;
+
+};
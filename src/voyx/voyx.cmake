@@ -1,3 +1,7 @@
+option(PROFILE "Enable hot-path profiling" OFF)
+option(ALLOCGUARD "Enable heap allocation tracking in the realtime path" OFF)
+option(SINGLE "Use single precision in the frequency domain" OFF)
+
 add_executable(voyx)
 
 file(GLOB_RECURSE
@@ -67,9 +71,37 @@ if (UNIX)
 
 endif()
 
+if (TARGET fftw)
+
+  target_link_libraries(voyx
+    PRIVATE fftw)
+
+endif()
+
 if (UI)
 
   target_compile_definitions(voyx
     PRIVATE VOYXUI)
 
 endif()
+
+if (PROFILE)
+
+  target_compile_definitions(voyx
+    PRIVATE VOYXPROFILE)
+
+endif()
+
+if (ALLOCGUARD)
+
+  target_compile_definitions(voyx
+    PRIVATE VOYXALLOCGUARD)
+
+endif()
+
+if (SINGLE)
+
+  target_compile_definitions(voyx
+    PRIVATE VOYXSINGLE)
+
+endif()